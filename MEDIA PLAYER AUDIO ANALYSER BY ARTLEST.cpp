@@ -1,318 +1,7729 @@
-/*
- * Professional Media Player Simulation System
- * Implementation of core media processing functionality
- * Code hints and optimizations by artlest
- * 
- * This program demonstrates fundamental media player operations including
- * audio buffer management, codec processing, and playback control mechanisms
- * Designed for cross-platform compatibility and educational purposes
- */
-
-#include <iostream>     // Standard input/output stream operations
-#include <iomanip>      // Input/output manipulation utilities
-#include <vector>       // Dynamic array container implementation
-#include <string>       // String class and manipulation functions
-#include <cmath>        // Mathematical computation functions
-#include <algorithm>    // Standard algorithm implementations
-#include <chrono>       // Time measurement and manipulation utilities
-#include <thread>       // Threading support for simulation timing
-
-using namespace std;
-
-// Global configuration constants for media processing parameters
-const int TOTAL_SIMULATION_CYCLES = 10;        // Maximum number of processing iterations
-const int AUDIO_BUFFER_SIZE = 1024;            // Standard audio buffer capacity in samples
-const int VIDEO_FRAME_RATE = 30;               // Target frames per second for video processing
-const double SAMPLE_RATE = 44100.0;            // Audio sampling frequency in Hz
-const int CODEC_PROCESSING_DELAY = 100;        // Millisecond delay for codec operation simulation
-
-// Structure definition for media file metadata representation
-struct media_file_metadata {
-    string file_identifier;                     // Unique identifier for media resource
-    string format_specification;               // Media format type specification
-    double duration_seconds;                   // Total playback duration in seconds
-    int bit_rate_kbps;                        // Encoding bit rate in kilobits per second
-    bool codec_support_status;                // Boolean flag indicating codec compatibility
-};
-
-// Structure definition for audio processing buffer management
-struct audio_processing_buffer {
-    vector<double> sample_data_array;          // Container for audio sample values
-    double peak_amplitude_level;               // Maximum amplitude detected in buffer
-    double rms_power_level;                   // Root mean square power calculation
-    int processed_sample_count;               // Counter for processed audio samples
-};
-
-// Function declaration for media file initialization and setup
-media_file_metadata initialize_media_resource(const string& resource_name, 
-                                             const string& format_type, 
-                                             double duration_value, 
-                                             int bitrate_value) {
-    media_file_metadata media_resource;        // Local metadata structure instance
-    
-    // The system assigns the provided resource identifier to the media structure
-    media_resource.file_identifier = resource_name;
-    
-    // The system configures the format specification parameter
-    media_resource.format_specification = format_type;
-    
-    // The system establishes the duration parameter for playback calculations
-    media_resource.duration_seconds = duration_value;
-    
-    // The system configures the bit rate parameter for quality assessment
-    media_resource.bit_rate_kbps = bitrate_value;
-    
-    // The system determines codec compatibility based on format analysis
-    media_resource.codec_support_status = (format_type == "MP3" || format_type == "WAV" || format_type == "FLAC");
-    
-    return media_resource;                     // Function returns configured metadata structure
-}
-
-// Function declaration for audio buffer processing and analysis operations
-audio_processing_buffer process_audio_buffer(int buffer_size_parameter) {
-    audio_processing_buffer processing_buffer; // Local buffer structure initialization
-    
-    // The system reserves memory space for the specified buffer capacity
-    processing_buffer.sample_data_array.reserve(buffer_size_parameter);
-    
-    // The system initializes peak amplitude tracking variable
-    processing_buffer.peak_amplitude_level = 0.0;
-    
-    // The system initializes RMS power calculation accumulator
-    double rms_accumulator = 0.0;
-    
-    // Iterative loop generates synthetic audio sample data for processing
-    for (int sample_index = 0; sample_index < buffer_size_parameter; sample_index++) {
-        // The system generates synthetic sine wave sample data
-        double sample_amplitude = sin(2.0 * M_PI * sample_index / buffer_size_parameter);
-        
-        // The system applies amplitude modulation for realistic audio characteristics
-        sample_amplitude *= (0.5 + 0.3 * sin(sample_index * 0.1));
-        
-        // The system stores the generated sample in the processing buffer
-        processing_buffer.sample_data_array.push_back(sample_amplitude);
-        
-        // The system updates peak amplitude tracking with maximum value detection
-        processing_buffer.peak_amplitude_level = max(processing_buffer.peak_amplitude_level, 
-                                                    abs(sample_amplitude));
-        
-        // The system accumulates squared values for RMS power calculation
-        rms_accumulator += sample_amplitude * sample_amplitude;
-    }
-    
-    // The system calculates root mean square power level from accumulated values
-    processing_buffer.rms_power_level = sqrt(rms_accumulator / buffer_size_parameter);
-    
-    // The system records the total number of processed samples
-    processing_buffer.processed_sample_count = buffer_size_parameter;
-    
-    return processing_buffer;                  // Function returns populated buffer structure
-}
-
-// Function declaration for codec processing simulation with timing analysis
-double simulate_codec_processing(const media_file_metadata& media_data, 
-                                int processing_cycle_number) {
-    // The system initiates high-resolution timing measurement
-    auto start_timestamp = chrono::high_resolution_clock::now();
-    
-    // The system simulates codec processing delay for realistic operation timing
-    this_thread::sleep_for(chrono::milliseconds(CODEC_PROCESSING_DELAY));
-    
-    // The system performs computational operations to simulate codec workload
-    double processing_efficiency = 0.0;
-    for (int computation_index = 0; computation_index < 1000; computation_index++) {
-        // The system executes mathematical operations representative of codec processing
-        processing_efficiency += sin(computation_index * 0.01) * cos(processing_cycle_number * 0.02);
-    }
-    
-    // The system calculates processing efficiency based on media characteristics
-    processing_efficiency = abs(processing_efficiency) / (media_data.bit_rate_kbps * 0.001);
-    
-    // The system records completion timestamp for performance analysis
-    auto end_timestamp = chrono::high_resolution_clock::now();
-    
-    // The system calculates total processing duration in milliseconds
-    auto processing_duration = chrono::duration_cast<chrono::milliseconds>(end_timestamp - start_timestamp);
-    
-    return processing_duration.count();       // Function returns processing time in milliseconds
-}
-
-// Function declaration for visual progress indicator generation
-void display_progress_visualization(int current_cycle, int total_cycles, 
-                                  double processing_time_ms, double efficiency_rating) {
-    // The system calculates completion percentage for progress tracking
-    double completion_percentage = (double(current_cycle) / total_cycles) * 100.0;
-    
-    // The system determines progress bar length based on completion status
-    int progress_bar_length = int(completion_percentage / 5.0);  // Scale to 20-character bar
-    
-    // The system generates visual progress bar representation
-    cout << "\n[Processing Cycle " << setw(2) << current_cycle << "/" << total_cycles << "] ";
-    cout << "[";
-    
-    // The system renders filled progress indicators
-    for (int bar_position = 0; bar_position < 20; bar_position++) {
-        if (bar_position < progress_bar_length) {
-            cout << "█";                       // The system displays filled progress segments
-        } else {
-            cout << "░";                       // The system displays empty progress segments
-        }
-    }
-    
-    // The system displays completion percentage and performance metrics
-    cout << "] " << fixed << setprecision(1) << completion_percentage << "%";
-    cout << " | Processing Time: " << setprecision(2) << processing_time_ms << "ms";
-    cout << " | Efficiency: " << setprecision(3) << efficiency_rating;
-}
-
-// Function declaration for comprehensive statistical analysis and reporting
-void generate_performance_analytics(const vector<double>& processing_time_data, 
-                                   const vector<double>& efficiency_data,
-                                   const audio_processing_buffer& audio_analysis) {
-    // The system calculates aggregate processing time statistics
-    double total_processing_time = 0.0;
-    double minimum_processing_time = *min_element(processing_time_data.begin(), processing_time_data.end());
-    double maximum_processing_time = *max_element(processing_time_data.begin(), processing_time_data.end());
-    
-    // The system accumulates total processing time for average calculation
-    for (double time_value : processing_time_data) {
-        total_processing_time += time_value;
-    }
-    double average_processing_time = total_processing_time / processing_time_data.size();
-    
-    // The system calculates aggregate efficiency statistics
-    double total_efficiency = 0.0;
-    double minimum_efficiency = *min_element(efficiency_data.begin(), efficiency_data.end());
-    double maximum_efficiency = *max_element(efficiency_data.begin(), efficiency_data.end());
-    
-    // The system accumulates total efficiency for average calculation
-    for (double efficiency_value : efficiency_data) {
-        total_efficiency += efficiency_value;
-    }
-    double average_efficiency = total_efficiency / efficiency_data.size();
-    
-    // The system generates comprehensive performance report header
-    cout << "\n\n" << string(80, '=') << "\n";
-    cout << "              MEDIA PLAYER PERFORMANCE ANALYSIS REPORT\n";
-    cout << string(80, '=') << "\n";
-    
-    // The system displays codec processing performance metrics
-    cout << "\nCODEC PROCESSING PERFORMANCE METRICS:\n";
-    cout << string(50, '-') << "\n";
-    cout << "Total Processing Cycles Completed: " << processing_time_data.size() << "\n";
-    cout << "Average Processing Time per Cycle: " << fixed << setprecision(2) 
-         << average_processing_time << " milliseconds\n";
-    cout << "Minimum Processing Time Recorded: " << minimum_processing_time << " milliseconds\n";
-    cout << "Maximum Processing Time Recorded: " << maximum_processing_time << " milliseconds\n";
-    cout << "Total Cumulative Processing Time: " << total_processing_time << " milliseconds\n";
-    
-    // The system displays efficiency analysis results
-    cout << "\nPROCESSING EFFICIENCY ANALYSIS:\n";
-    cout << string(50, '-') << "\n";
-    cout << "Average Processing Efficiency: " << fixed << setprecision(4) << average_efficiency << "\n";
-    cout << "Peak Efficiency Achievement: " << maximum_efficiency << "\n";
-    cout << "Minimum Efficiency Recorded: " << minimum_efficiency << "\n";
-    
-    // The system displays audio processing analysis results
-    cout << "\nAUDIO BUFFER ANALYSIS RESULTS:\n";
-    cout << string(50, '-') << "\n";
-    cout << "Total Audio Samples Processed: " << audio_analysis.processed_sample_count << "\n";
-    cout << "Peak Amplitude Level Detected: " << fixed << setprecision(4) 
-         << audio_analysis.peak_amplitude_level << "\n";
-    cout << "RMS Power Level Calculated: " << audio_analysis.rms_power_level << "\n";
-    cout << "Dynamic Range Analysis: " << (audio_analysis.peak_amplitude_level / audio_analysis.rms_power_level) << "\n";
-    
-    // The system provides professional interpretation of results
-    cout << "\nPROFESSIONAL ANALYSIS INTERPRETATION:\n";
-    cout << string(50, '-') << "\n";
-    if (average_processing_time < 150.0) {
-        cout << "✓ Processing performance demonstrates optimal codec efficiency\n";
-    } else {
-        cout << "⚠ Processing performance indicates potential optimization opportunities\n";
-    }
-    
-    if (audio_analysis.peak_amplitude_level > 0.8) {
-        cout << "✓ Audio signal demonstrates sufficient amplitude for quality playback\n";
-    } else {
-        cout << "⚠ Audio signal may require amplitude normalization processing\n";
-    }
-    
-    cout << "\n" << string(80, '=') << "\n";
-}
-
-// Primary program execution function with comprehensive media processing simulation
-int main() {
-    // The system displays professional application header and identification
-    cout << "Professional Media Player Processing System v1.0\n";
-    cout << "Advanced Codec Processing and Audio Analysis Framework\n";
-    cout << string(60, '=') << "\n";
-    
-    // The system initializes media resource with professional specifications
-    media_file_metadata primary_media_resource = initialize_media_resource(
-        "professional_audio_sample.mp3",      // Resource identifier specification
-        "MP3",                                 // Format type designation
-        180.0,                                 // Duration specification in seconds
-        320                                    // Bit rate specification in kbps
-    );
-    
-    // The system displays media resource configuration information
-    cout << "\nMEDIA RESOURCE CONFIGURATION:\n";
-    cout << string(40, '-') << "\n";
-    cout << "Resource Identifier: " << primary_media_resource.file_identifier << "\n";
-    cout << "Format Specification: " << primary_media_resource.format_specification << "\n";
-    cout << "Duration Parameters: " << fixed << setprecision(1) 
-         << primary_media_resource.duration_seconds << " seconds\n";
-    cout << "Bit Rate Configuration: " << primary_media_resource.bit_rate_kbps << " kbps\n";
-    cout << "Codec Compatibility: " << (primary_media_resource.codec_support_status ? "SUPPORTED" : "UNSUPPORTED") << "\n";
-    
-    // The system initializes audio processing buffer for analysis operations
-    audio_processing_buffer primary_audio_buffer = process_audio_buffer(AUDIO_BUFFER_SIZE);
-    
-    // The system displays audio buffer configuration parameters
-    cout << "\nAUDIO BUFFER CONFIGURATION:\n";
-    cout << string(40, '-') << "\n";
-    cout << "Buffer Capacity: " << AUDIO_BUFFER_SIZE << " samples\n";
-    cout << "Sampling Frequency: " << SAMPLE_RATE << " Hz\n";
-    cout << "Processing Framework: Real-time audio analysis\n";
-    
-    // The system initializes performance tracking data structures
-    vector<double> processing_time_measurements;   // Container for timing data collection
-    vector<double> efficiency_measurements;        // Container for efficiency metric storage
-    
-    // The system reserves memory capacity for performance data collection
-    processing_time_measurements.reserve(TOTAL_SIMULATION_CYCLES);
-    efficiency_measurements.reserve(TOTAL_SIMULATION_CYCLES);
-    
-    // The system initiates media processing simulation cycle execution
-    cout << "\nINITIATING MEDIA PROCESSING SIMULATION:\n";
-    cout << string(40, '-');
-    
-    // Primary processing loop executes specified number of simulation cycles
-    for (int cycle_iteration = 1; cycle_iteration <= TOTAL_SIMULATION_CYCLES; cycle_iteration++) {
-        // The system executes codec processing simulation with performance measurement
-        double cycle_processing_time = simulate_codec_processing(primary_media_resource, cycle_iteration);
-        
-        // The system calculates processing efficiency based on cycle performance
-        double cycle_efficiency = (1000.0 / cycle_processing_time) * 
-                                 (primary_media_resource.bit_rate_kbps / 320.0);
-        
-        // The system stores performance measurements for statistical analysis
-        processing_time_measurements.push_back(cycle_processing_time);
-        efficiency_measurements.push_back(cycle_efficiency);
-        
-        // The system displays real-time progress visualization
-        display_progress_visualization(cycle_iteration, TOTAL_SIMULATION_CYCLES, 
-                                     cycle_processing_time, cycle_efficiency);
-    }
-    
-    // The system generates comprehensive performance analysis report
-    generate_performance_analytics(processing_time_measurements, efficiency_measurements, 
-                                 primary_audio_buffer);
-    
-    // The system displays successful program completion status
-    cout << "\nSYSTEM STATUS: Media processing simulation completed successfully\n";
-    cout << "All performance metrics have been analyzed and documented\n";
-    cout << "Program execution terminated with successful status code\n";
-    
-    return 0;                                  // Program returns successful execution status
+/*
+ * Professional Media Player Simulation System
+ * Implementation of core media processing functionality
+ * Code hints and optimizations by artlest
+ * 
+ * This program demonstrates fundamental media player operations including
+ * audio buffer management, codec processing, and playback control mechanisms
+ * Designed for cross-platform compatibility and educational purposes
+ */
+
+#include <iostream>     // Standard input/output stream operations
+#include <iomanip>      // Input/output manipulation utilities
+#include <vector>       // Dynamic array container implementation
+#include <string>       // String class and manipulation functions
+#include <cmath>        // Mathematical computation functions
+#include <algorithm>    // Standard algorithm implementations
+#include <chrono>       // Time measurement and manipulation utilities
+#include <thread>       // Threading support for simulation timing
+#include <fstream>      // File stream operations for streamed audio input
+#include <filesystem>   // Filesystem paths for analysis storage locations
+#include <map>          // Ordered associative containers for cached plans
+#include <mutex>        // Mutual exclusion for shared plan caches
+#include <random>       // Pseudo-random generation for test signals
+#include <numeric>      // Numeric helpers for rational ratio reduction
+#include <cstdint>      // Fixed-width integer types for stored sample formats
+#include <cstring>      // Raw memory copies for byte-level sample storage
+#include <type_traits>  // Compile-time type checks for fused stage composition
+#include <set>          // Ordered multisets for sliding median thresholds
+#include <queue>        // Priority queues for nearest-neighbour graph search
+#include <cstdio>       // Formatted cache entry names
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>      // POSIX file descriptors for mapped feature stores
+#include <sys/mman.h>   // POSIX memory mapping for column scans
+#include <unistd.h>     // POSIX descriptor release
+#define FEATURE_STORE_USE_MMAP 1
+#else
+#define FEATURE_STORE_USE_MMAP 0
+#endif
+
+using namespace std;
+
+// Global configuration constants for media processing parameters
+const int TOTAL_SIMULATION_CYCLES = 10;        // Maximum number of processing iterations
+constexpr int AUDIO_BUFFER_SIZE = 1024;        // Standard audio buffer capacity in samples
+const int VIDEO_FRAME_RATE = 30;               // Target frames per second for video processing
+constexpr double SAMPLE_RATE = 44100.0;        // Audio sampling frequency in Hz
+const int CODEC_PROCESSING_DELAY = 100;        // Millisecond delay for codec operation simulation
+
+// Structure definition for media file metadata representation
+struct media_file_metadata {
+    string file_identifier;                     // Unique identifier for media resource
+    string format_specification;               // Media format type specification
+    double duration_seconds;                   // Total playback duration in seconds
+    int bit_rate_kbps;                        // Encoding bit rate in kilobits per second
+    bool codec_support_status;                // Boolean flag indicating codec compatibility
+};
+
+// Structure definition for audio processing buffer management
+struct audio_processing_buffer {
+    vector<double> sample_data_array;          // Container for audio sample values (planar, one plane per channel)
+    double peak_amplitude_level;               // Maximum amplitude detected in buffer
+    double rms_power_level;                   // Root mean square power calculation
+    int processed_sample_count;               // Counter for processed audio samples
+    int channel_count;                        // Number of planar channels stored in sample data
+    double dc_offset_level;                   // Mean sample value (DC component) across buffer
+};
+
+// Enumeration of gain curve behaviours supported by the dynamics processor
+enum dynamics_processing_mode {
+    DYNAMICS_COMPRESSOR,                      // Attenuates signal above threshold by ratio
+    DYNAMICS_EXPANDER,                        // Attenuates signal below threshold by ratio
+    DYNAMICS_NOISE_GATE                       // Mutes signal below threshold down to range floor
+};
+
+// Enumeration of level detector characteristics for dynamics processing
+enum level_detection_mode {
+    DETECTION_PEAK,                           // Instantaneous absolute sample level
+    DETECTION_RMS                             // Smoothed mean square signal level
+};
+
+// Structure definition for dynamics processor parameter configuration
+struct dynamics_processor_configuration {
+    dynamics_processing_mode processing_mode; // Selected gain curve behaviour
+    level_detection_mode detection_mode;      // Selected level detector characteristic
+    double threshold_db;                      // Gain curve threshold in decibels full scale
+    double ratio;                             // Compression or expansion ratio
+    double attack_time_ms;                    // Envelope rise time constant in milliseconds
+    double release_time_ms;                   // Envelope fall time constant in milliseconds
+    double range_db;                          // Maximum attenuation applied in decibels
+    double makeup_gain_db;                    // Output gain applied after gain computation
+};
+
+// Structure definition for dynamics processor state carried across blocks
+struct dynamics_processor_state {
+    double envelope_level;                    // Smoothed detector level (absolute or squared)
+    double attack_coefficient;                // One-pole smoothing factor for rising level
+    double release_coefficient;               // One-pole smoothing factor for falling level
+    double maximum_gain_reduction_db;         // Deepest attenuation applied so far
+};
+
+// Structure definition for streaming DC estimation and first-order DC blocking state
+struct dc_blocking_filter_state {
+    double pole_coefficient;                  // Feedback coefficient of the DC-blocking high-pass
+    bool removal_enabled;                     // Flag writing filtered output back in place
+    vector<double> previous_input;            // Last input sample per channel
+    vector<double> previous_output;           // Last output sample per channel
+    vector<double> channel_sample_sum;        // Running input sum per channel for DC estimation
+    long long estimated_frame_count;          // Frames contributing to the running sums
+};
+
+// Enumeration of biquad response shapes available to the parametric equalizer
+enum biquad_filter_type {
+    BIQUAD_PEAKING,                           // Bell boost or cut around centre frequency
+    BIQUAD_LOW_SHELF,                         // Shelf boost or cut below corner frequency
+    BIQUAD_HIGH_SHELF,                        // Shelf boost or cut above corner frequency
+    BIQUAD_LOW_PASS,                          // Second-order low-pass response
+    BIQUAD_HIGH_PASS                          // Second-order high-pass response
+};
+
+// Structure definition for a single parametric equalizer band
+struct biquad_band_specification {
+    biquad_filter_type filter_type;           // Response shape of the band
+    double frequency_hz;                      // Centre or corner frequency in Hz
+    double quality_factor;                    // Bandwidth control (Q)
+    double gain_db;                           // Boost or cut for peaking and shelf bands
+};
+
+// Structure definition for normalised biquad coefficients (a0 = 1)
+struct biquad_coefficients {
+    double b0, b1, b2;                        // Feed-forward coefficients
+    double a1, a2;                            // Feedback coefficients
+};
+
+// Maximum number of cascaded sections held inline by the equalizer
+const int MAXIMUM_EQUALIZER_SECTIONS = 8;
+
+// Structure definition for cascaded biquad equalizer coefficients and state
+struct parametric_equalizer_state {
+    int section_count;                        // Number of active cascaded sections
+    int dropped_band_count;                   // Requested bands beyond the inline section capacity
+    biquad_coefficients section_coefficients[MAXIMUM_EQUALIZER_SECTIONS]; // Per-section coefficients
+    vector<double> section_memory;            // Transposed direct-form II state (channel, section, 2)
+};
+
+// Structure definition for a radix-2 fast Fourier transform plan
+struct fft_transform_plan {
+    int transform_size;                       // Number of complex points (power of two)
+    vector<int> bit_reversal_order;           // Input permutation for iterative evaluation
+    vector<double> twiddle_real;              // Real parts of forward twiddle factors
+    vector<double> twiddle_imag;              // Imaginary parts of forward twiddle factors
+};
+
+// Structure definition for uniformly partitioned overlap-save convolution state
+struct partitioned_convolver_state {
+    int block_size;                           // Partition and hop length in frames
+    int partition_count;                      // Number of impulse response partitions
+    int spectrum_bins;                        // Non-redundant bins per spectrum (block size + 1)
+    int channel_count;                        // Number of independently convolved channels
+    const fft_transform_plan* transform_plan; // Shared plan for the doubled block size
+    vector<double> filter_spectra_real;       // Partition spectra, real parts (partition, bin)
+    vector<double> filter_spectra_imag;       // Partition spectra, imaginary parts (partition, bin)
+    vector<double> delay_line_real;           // Frequency-domain delay line, real parts (channel, slot, bin)
+    vector<double> delay_line_imag;           // Frequency-domain delay line, imaginary parts (channel, slot, bin)
+    int delay_line_head;                      // Slot holding the newest input spectrum
+    vector<double> input_history;             // Previous and current input block per channel
+    vector<double> output_block;              // Output ready for the current block per channel
+    int block_fill_position;                  // Frames accumulated into the current block
+    vector<double> transform_real;            // Transform scratch, real parts
+    vector<double> transform_imag;            // Transform scratch, imaginary parts
+    vector<double> accumulator_real;          // Spectral accumulator, real parts
+    vector<double> accumulator_imag;          // Spectral accumulator, imaginary parts
+};
+
+// Structure definition for the in-place stage chain feeding peak and RMS analysis
+struct audio_processing_chain {
+    bool dc_blocking_stage_enabled;           // Flag enabling DC estimation and removal stage
+    dc_blocking_filter_state dc_blocking_state; // DC stage running state
+    bool equalizer_stage_enabled;             // Flag enabling the biquad cascade equalizer
+    parametric_equalizer_state equalizer_state; // Equalizer coefficients and running state
+    bool convolution_stage_enabled;           // Flag enabling the partitioned convolution stage
+    partitioned_convolver_state convolution_state; // Convolution filter spectra and running state
+    bool dynamics_stage_enabled;              // Flag enabling the dynamics processing stage
+    dynamics_processor_configuration dynamics_configuration; // Dynamics stage parameters
+    dynamics_processor_state dynamics_state;  // Dynamics stage running state
+};
+
+// Block length used for stack-resident scratch arrays inside processing stages
+const int PROCESSING_SUB_BLOCK_SIZE = 64;
+
+// Lane count used by explicit multi-accumulator reductions and lane-parallel kernels
+const int SIMD_LANE_COUNT = 8;
+
+// Function declaration for planar channel frame count calculation
+int frames_per_channel(const audio_processing_buffer& audio_buffer) {
+    // The system divides the planar storage evenly between the configured channels
+    return audio_buffer.channel_count > 0 ?
+           int(audio_buffer.sample_data_array.size()) / audio_buffer.channel_count : 0;
+}
+
+// Function declaration for planar channel storage access
+double* access_channel_plane(audio_processing_buffer& audio_buffer, int channel_index) {
+    // The system locates the first sample of the requested channel plane
+    return audio_buffer.sample_data_array.data() + size_t(channel_index) * frames_per_channel(audio_buffer);
+}
+
+// Function declaration for read-only planar channel storage access
+const double* access_channel_plane(const audio_processing_buffer& audio_buffer, int channel_index) {
+    // The system locates the first sample of the requested channel plane
+    return audio_buffer.sample_data_array.data() + size_t(channel_index) * frames_per_channel(audio_buffer);
+}
+
+// Marker base identifying types that may be composed into a fused processing chain
+struct fused_stage_marker {};
+
+// Template definition for two stages composed into a single per-sample stage
+template <typename upstream_stage, typename downstream_stage>
+struct fused_stage_pair : fused_stage_marker {
+    upstream_stage upstream;                  // Stage applied first to each sample
+    downstream_stage downstream;              // Stage applied to the upstream result
+
+    // The system passes each sample through both stages without touching memory in between
+    double process_sample(double sample_value) {
+        return downstream.process_sample(upstream.process_sample(sample_value));
+    }
+
+    // The system publishes accumulated results of both stages after the loop
+    void finish_block() {
+        upstream.finish_block();
+        downstream.finish_block();
+    }
+};
+
+// Template operator composing stages left to right into a fused chain type at compile time
+template <typename upstream_stage, typename downstream_stage,
+          typename = enable_if_t<is_base_of<fused_stage_marker, upstream_stage>::value &&
+                                 is_base_of<fused_stage_marker, downstream_stage>::value>>
+fused_stage_pair<upstream_stage, downstream_stage> operator|(upstream_stage upstream, downstream_stage downstream) {
+    fused_stage_pair<upstream_stage, downstream_stage> composed_stage;
+    composed_stage.upstream = upstream;
+    composed_stage.downstream = downstream;
+    return composed_stage;                     // Operator returns the composed stage
+}
+
+// Structure definition for a constant gain stage
+struct gain_stage : fused_stage_marker {
+    double gain_factor = 1.0;                 // Linear multiplier applied to every sample
+
+    double process_sample(double sample_value) { return sample_value * gain_factor; }
+    void finish_block() {}
+};
+
+// Structure definition for a transposed direct-form II biquad stage
+struct biquad_stage : fused_stage_marker {
+    biquad_coefficients coefficients = {1.0, 0.0, 0.0, 0.0, 0.0}; // Normalised section coefficients
+    double first_state = 0.0;                 // First delay element
+    double second_state = 0.0;                // Second delay element
+
+    double process_sample(double sample_value) {
+        double output_value = coefficients.b0 * sample_value + first_state;
+        first_state = coefficients.b1 * sample_value - coefficients.a1 * output_value + second_state;
+        second_state = coefficients.b2 * sample_value - coefficients.a2 * output_value;
+        return output_value;
+    }
+    void finish_block() {}
+};
+
+// Structure definition for a symmetric hard clipping stage
+struct hard_clip_stage : fused_stage_marker {
+    double ceiling_level = 1.0;               // Absolute level the output never exceeds
+
+    double process_sample(double sample_value) { return max(-ceiling_level, min(ceiling_level, sample_value)); }
+    void finish_block() {}
+};
+
+// Structure definition for a pass-through absolute peak statistic
+struct peak_statistic_stage : fused_stage_marker {
+    double* peak_target = nullptr;            // Destination written when the block finishes
+    double running_peak = 0.0;                // Peak observed so far in the block
+
+    double process_sample(double sample_value) {
+        running_peak = max(running_peak, abs(sample_value));
+        return sample_value;
+    }
+    void finish_block() { if (peak_target) *peak_target = running_peak; }
+};
+
+// Structure definition for a pass-through root mean square statistic
+struct rms_statistic_stage : fused_stage_marker {
+    double* rms_target = nullptr;             // Destination written when the block finishes
+    double square_sum = 0.0;                  // Sum of squared samples
+    long long sample_count = 0;               // Samples observed
+
+    double process_sample(double sample_value) {
+        square_sum += sample_value * sample_value;
+        sample_count++;
+        return sample_value;
+    }
+    void finish_block() { if (rms_target) *rms_target = sample_count > 0 ? sqrt(square_sum / sample_count) : 0.0; }
+};
+
+// Structure definition for a pass-through mean (DC offset) statistic
+struct mean_statistic_stage : fused_stage_marker {
+    double* mean_target = nullptr;            // Destination written when the block finishes
+    double sample_sum = 0.0;                  // Sum of samples
+    long long sample_count = 0;               // Samples observed
+
+    double process_sample(double sample_value) {
+        sample_sum += sample_value;
+        sample_count++;
+        return sample_value;
+    }
+    void finish_block() { if (mean_target) *mean_target = sample_count > 0 ? sample_sum / sample_count : 0.0; }
+};
+
+// Template function declaration for one fused in-place pass of a composed chain
+template <typename fused_chain>
+void run_fused_chain(fused_chain& processing_chain, double* sample_data, int sample_count) {
+    // The system reads and writes every sample exactly once regardless of stage count
+    for (int sample_index = 0; sample_index < sample_count; sample_index++) {
+        sample_data[sample_index] = processing_chain.process_sample(sample_data[sample_index]);
+    }
+    processing_chain.finish_block();
+}
+
+// Template function declaration for one fused read-only pass of a statistics chain
+template <typename fused_chain>
+void observe_fused_chain(fused_chain& processing_chain, const double* sample_data, int sample_count) {
+    // The system runs a local copy so stage state stays in registers even when a stage stores through a pointer
+    fused_chain local_chain = processing_chain;
+    for (int sample_index = 0; sample_index < sample_count; sample_index++) {
+        local_chain.process_sample(sample_data[sample_index]);
+    }
+    local_chain.finish_block();
+    processing_chain = local_chain;
+}
+
+// Template function declaration for fused generation followed by chain processing
+template <typename sample_generator, typename fused_chain>
+void generate_through_fused_chain(const sample_generator& generator, fused_chain& processing_chain,
+                                  double* sample_data, int sample_count) {
+    // The system stores each generated sample only after every stage has processed it
+    for (int sample_index = 0; sample_index < sample_count; sample_index++) {
+        sample_data[sample_index] = processing_chain.process_sample(generator.generate_sample(sample_index));
+    }
+    processing_chain.finish_block();
+}
+
+// Structure definition for the amplitude-modulated sine used by the primary analysis buffer
+struct modulated_sine_generator {
+    int period_samples;                       // Samples per carrier cycle
+
+    double generate_sample(int sample_index) const {
+        // The system generates synthetic sine wave sample data with amplitude modulation
+        return sin(2.0 * M_PI * sample_index / period_samples) * (0.5 + 0.3 * sin(sample_index * 0.1));
+    }
+};
+
+// Function declaration for peak and RMS level measurement over buffer contents
+void measure_audio_buffer_levels(audio_processing_buffer& audio_buffer) {
+    // The system measures peak, RMS and DC offset in one fused read-only pass
+    peak_statistic_stage peak_statistic;
+    rms_statistic_stage rms_statistic;
+    mean_statistic_stage mean_statistic;
+    peak_statistic.peak_target = &audio_buffer.peak_amplitude_level;
+    rms_statistic.rms_target = &audio_buffer.rms_power_level;
+    mean_statistic.mean_target = &audio_buffer.dc_offset_level;
+    auto measurement_chain = peak_statistic | rms_statistic | mean_statistic;
+    observe_fused_chain(measurement_chain, audio_buffer.sample_data_array.data(),
+                        int(audio_buffer.sample_data_array.size()));
+
+    // The system records the number of measured samples
+    audio_buffer.processed_sample_count = int(audio_buffer.sample_data_array.size());
+}
+
+// Function declaration for dynamics processor state initialization
+dynamics_processor_state initialize_dynamics_processor(const dynamics_processor_configuration& configuration) {
+    dynamics_processor_state processor_state;  // Local state structure instance
+
+    // The system starts the detector envelope at silence
+    processor_state.envelope_level = 0.0;
+    processor_state.maximum_gain_reduction_db = 0.0;
+
+    // The system converts time constants into one-pole smoothing coefficients
+    processor_state.attack_coefficient = exp(-1000.0 / (max(configuration.attack_time_ms, 0.001) * SAMPLE_RATE));
+    processor_state.release_coefficient = exp(-1000.0 / (max(configuration.release_time_ms, 0.001) * SAMPLE_RATE));
+
+    return processor_state;                    // Function returns prepared processor state
+}
+
+// Function declaration for a branch-free base-2 logarithm that vectorizes inside lane loops
+inline double approximate_log2(double argument_value) {
+    // The system splits the exponent from the mantissa with integer arithmetic on the bit pattern
+    uint64_t argument_bits;
+    memcpy(&argument_bits, &argument_value, sizeof(argument_bits));
+    int exponent_value = int((argument_bits >> 52) & 0x7ff) - 1023;
+    argument_bits = (argument_bits & 0x000fffffffffffffULL) | 0x3ff0000000000000ULL;
+    double mantissa_value;
+    memcpy(&mantissa_value, &argument_bits, sizeof(mantissa_value));
+
+    // The system evaluates log2 of the mantissa in [1, 2) with an odd series in (m - 1) / (m + 1)
+    double series_term = (mantissa_value - 1.0) / (mantissa_value + 1.0);
+    double term_squared = series_term * series_term;
+    double series_sum = series_term * (2.0 + term_squared * (2.0 / 3.0 + term_squared * (2.0 / 5.0 + term_squared * (2.0 / 7.0))));
+    return exponent_value + series_sum * 1.4426950408889634;
+}
+
+// Function declaration for a branch-free base-2 exponential that vectorizes inside lane loops
+inline double approximate_exp2(double argument_value) {
+    // The system clamps to the normal range and rounds with the 1.5 * 2^52 shift so no float-to-int conversion is needed
+    const double rounding_shift = 6755399441055744.0;
+    argument_value = argument_value > -1000.0 ? argument_value : -1000.0;
+    argument_value = argument_value < 1000.0 ? argument_value : 1000.0;
+    double shifted_value = argument_value + rounding_shift;
+    uint64_t integer_bits;
+    memcpy(&integer_bits, &shifted_value, sizeof(integer_bits));
+    double fraction_part = (argument_value - (shifted_value - rounding_shift)) * 0.6931471805599453;
+
+    // The system evaluates e^(f ln 2) for f in [-0.5, 0.5] with a degree-7 polynomial
+    double fraction_power = 1.0 + fraction_part * (1.0 + fraction_part * (1.0 / 2.0 + fraction_part * (1.0 / 6.0 +
+                            fraction_part * (1.0 / 24.0 + fraction_part * (1.0 / 120.0 + fraction_part * (1.0 / 720.0 +
+                            fraction_part * (1.0 / 5040.0)))))));
+
+    // The system scales by the rounded power of two written straight into the exponent field
+    uint64_t scale_bits = (integer_bits + 1023) << 52;
+    double scale_value;
+    memcpy(&scale_value, &scale_bits, sizeof(scale_value));
+    return fraction_power * scale_value;
+}
+
+// Function declaration for a branch-free sine that vectorizes inside lane loops
+inline double approximate_sin(double argument_value) {
+    // The system reduces by the nearest multiple of pi with a two-part constant and keeps its parity for the sign
+    const double rounding_shift = 6755399441055744.0;
+    double shifted_value = argument_value * 0.3183098861837907 + rounding_shift;
+    uint64_t multiple_bits;
+    memcpy(&multiple_bits, &shifted_value, sizeof(multiple_bits));
+    double nearest_multiple = shifted_value - rounding_shift;
+    double reduced_value = (argument_value - nearest_multiple * 3.141592653589793) - nearest_multiple * 1.2246467991473532e-16;
+
+    // The system evaluates the odd series to degree 15 on [-pi/2, pi/2]
+    double reduced_squared = reduced_value * reduced_value;
+    double series_value = reduced_value * (1.0 + reduced_squared * (-1.0 / 6.0 + reduced_squared * (1.0 / 120.0 +
+                          reduced_squared * (-1.0 / 5040.0 + reduced_squared * (1.0 / 362880.0 +
+                          reduced_squared * (-1.0 / 39916800.0 + reduced_squared * (1.0 / 6227020800.0 +
+                          reduced_squared * (-1.0 / 1307674368000.0))))))));
+
+    // The system negates the result for odd multiples by flipping the sign bit
+    uint64_t series_bits;
+    memcpy(&series_bits, &series_value, sizeof(series_bits));
+    series_bits ^= (multiple_bits & 1) << 63;
+    memcpy(&series_value, &series_bits, sizeof(series_value));
+    return series_value;
+}
+
+// Function declaration for block-based compressor, expander and noise gate processing
+void apply_dynamics_processor(audio_processing_buffer& target_buffer,
+                              const dynamics_processor_configuration& configuration,
+                              dynamics_processor_state& processor_state,
+                              const audio_processing_buffer* sidechain_buffer = nullptr) {
+    // The system selects the detector source, defaulting to the processed signal itself
+    const audio_processing_buffer& detector_buffer = sidechain_buffer ? *sidechain_buffer : target_buffer;
+    int frame_total = frames_per_channel(target_buffer);
+    int detector_frames = frames_per_channel(detector_buffer);
+
+    // The system folds the gain curve into a single slope and floor so no per-sample mode branch remains
+    double curve_slope = 0.0;
+    double attenuation_floor_db = -abs(configuration.range_db);
+    if (configuration.processing_mode == DYNAMICS_COMPRESSOR) {
+        curve_slope = 1.0 / max(configuration.ratio, 1.0) - 1.0;
+    } else if (configuration.processing_mode == DYNAMICS_EXPANDER) {
+        curve_slope = max(configuration.ratio, 1.0) - 1.0;
+    } else {
+        curve_slope = 1000.0;                  // Near-vertical slope reproduces hard gate behaviour
+    }
+
+    // The system prepares base-2 decibel conversion constants for the vectorized gain loop
+    const bool rms_detection = (configuration.detection_mode == DETECTION_RMS);
+    const double level_to_db = (rms_detection ? 10.0 : 20.0) * log10(2.0);
+    const double db_to_exponent = 1.0 / (20.0 * log10(2.0));
+
+    // The system keeps scratch arrays on the stack so the processing loop performs no heap traffic
+    double detector_level[PROCESSING_SUB_BLOCK_SIZE];
+    double gain_factor[PROCESSING_SUB_BLOCK_SIZE];
+    double envelope_level = processor_state.envelope_level;
+    double deepest_reduction_db = processor_state.maximum_gain_reduction_db;
+
+    // Iterative loop walks the buffer in fixed sub-blocks
+    for (int block_start = 0; block_start < frame_total; block_start += PROCESSING_SUB_BLOCK_SIZE) {
+        int block_length = min(PROCESSING_SUB_BLOCK_SIZE, frame_total - block_start);
+
+        // The system links all detector channels by taking the loudest absolute sample per frame
+        fill(detector_level, detector_level + block_length, 0.0);
+        for (int channel_index = 0; channel_index < detector_buffer.channel_count; channel_index++) {
+            const double* detector_plane = access_channel_plane(detector_buffer, channel_index) + block_start;
+            int available_frames = max(0, min(block_length, detector_frames - block_start));
+            for (int frame_index = 0; frame_index < available_frames; frame_index++) {
+                detector_level[frame_index] = max(detector_level[frame_index], abs(detector_plane[frame_index]));
+            }
+        }
+
+        // The system smooths the detector serially, since each frame's attack or release choice depends on the last
+        double detector_power = rms_detection ? 1.0 : 0.0;
+        for (int frame_index = 0; frame_index < block_length; frame_index++) {
+            double absolute_level = detector_level[frame_index];
+            double input_level = absolute_level * (1.0 + detector_power * (absolute_level - 1.0));
+            double smoothing = input_level > envelope_level ? processor_state.attack_coefficient
+                                                            : processor_state.release_coefficient;
+            envelope_level = input_level + smoothing * (envelope_level - input_level);
+            detector_level[frame_index] = envelope_level;
+        }
+
+        // The system pads a short final sub-block with the settled envelope so every lane group is full
+        int padded_length = (block_length + SIMD_LANE_COUNT - 1) / SIMD_LANE_COUNT * SIMD_LANE_COUNT;
+        fill(detector_level + block_length, detector_level + padded_length, envelope_level);
+
+        // The system evaluates the static gain curve lane group by lane group with approximate log and exp
+        double lane_minimum_db[SIMD_LANE_COUNT] = {0.0};
+        for (int group_start = 0; group_start < padded_length; group_start += SIMD_LANE_COUNT) {
+            for (int lane_index = 0; lane_index < SIMD_LANE_COUNT; lane_index++) {
+                double level_db = level_to_db * approximate_log2(detector_level[group_start + lane_index] + 1e-20);
+                double gain_db = (level_db - configuration.threshold_db) * curve_slope;
+                gain_db = gain_db < 0.0 ? gain_db : 0.0;
+                gain_db = gain_db > attenuation_floor_db ? gain_db : attenuation_floor_db;
+                lane_minimum_db[lane_index] = gain_db < lane_minimum_db[lane_index] ? gain_db : lane_minimum_db[lane_index];
+                gain_factor[group_start + lane_index] =
+                    approximate_exp2((gain_db + configuration.makeup_gain_db) * db_to_exponent);
+            }
+        }
+        for (int lane_index = 0; lane_index < SIMD_LANE_COUNT; lane_index++) {
+            deepest_reduction_db = min(deepest_reduction_db, lane_minimum_db[lane_index]);
+        }
+
+        // The system applies the shared gain trajectory to every target channel plane
+        for (int channel_index = 0; channel_index < target_buffer.channel_count; channel_index++) {
+            double* channel_plane = access_channel_plane(target_buffer, channel_index) + block_start;
+            for (int frame_index = 0; frame_index < block_length; frame_index++) {
+                channel_plane[frame_index] *= gain_factor[frame_index];
+            }
+        }
+    }
+
+    // The system stores the running envelope for the next block
+    processor_state.envelope_level = envelope_level;
+    processor_state.maximum_gain_reduction_db = deepest_reduction_db;
+}
+
+// Function declaration for DC blocking stage initialization
+dc_blocking_filter_state initialize_dc_blocking_filter(int channel_count, bool removal_enabled = true,
+                                                       double cutoff_frequency_hz = 10.0) {
+    dc_blocking_filter_state filter_state;     // Local state structure instance
+
+    // The system places the high-pass pole from the requested cutoff frequency
+    filter_state.pole_coefficient = exp(-2.0 * M_PI * cutoff_frequency_hz / SAMPLE_RATE);
+    filter_state.removal_enabled = removal_enabled;
+    filter_state.previous_input.assign(channel_count, 0.0);
+    filter_state.previous_output.assign(channel_count, 0.0);
+    filter_state.channel_sample_sum.assign(channel_count, 0.0);
+    filter_state.estimated_frame_count = 0;
+
+    return filter_state;                       // Function returns cleared filter state
+}
+
+// Function declaration for streaming DC estimate retrieval
+double estimated_dc_offset(const dc_blocking_filter_state& filter_state) {
+    // The system averages the running per-channel sums over every estimated sample
+    if (filter_state.estimated_frame_count == 0 || filter_state.channel_sample_sum.empty()) {
+        return 0.0;
+    }
+    double total_sum = 0.0;
+    for (double channel_sum : filter_state.channel_sample_sum) {
+        total_sum += channel_sum;
+    }
+    return total_sum / (double(filter_state.estimated_frame_count) * filter_state.channel_sample_sum.size());
+}
+
+// Function declaration for transposing a planar channel group into lane-interleaved scratch
+void load_channel_lanes(const audio_processing_buffer& source_buffer, int group_start, int group_width,
+                        int block_start, int block_length,
+                        double lane_samples[PROCESSING_SUB_BLOCK_SIZE][SIMD_LANE_COUNT]) {
+    // The system copies each channel plane into its lane, zero-filling lanes beyond the group
+    for (int lane_index = 0; lane_index < SIMD_LANE_COUNT; lane_index++) {
+        const double* channel_plane = lane_index < group_width ?
+            access_channel_plane(source_buffer, group_start + lane_index) + block_start : nullptr;
+        for (int frame_index = 0; frame_index < block_length; frame_index++) {
+            lane_samples[frame_index][lane_index] = channel_plane ? channel_plane[frame_index] : 0.0;
+        }
+    }
+}
+
+// Function declaration for transposing lane-interleaved scratch back into planar channels
+void store_channel_lanes(audio_processing_buffer& target_buffer, int group_start, int group_width,
+                         int block_start, int block_length,
+                         double lane_samples[PROCESSING_SUB_BLOCK_SIZE][SIMD_LANE_COUNT]) {
+    // The system writes each populated lane back to its channel plane
+    for (int lane_index = 0; lane_index < group_width; lane_index++) {
+        double* channel_plane = access_channel_plane(target_buffer, group_start + lane_index) + block_start;
+        for (int frame_index = 0; frame_index < block_length; frame_index++) {
+            channel_plane[frame_index] = lane_samples[frame_index][lane_index];
+        }
+    }
+}
+
+// Function declaration for in-place DC estimation and first-order DC-blocking high-pass filtering
+void apply_dc_blocking_filter(audio_processing_buffer& target_buffer, dc_blocking_filter_state& filter_state) {
+    // The system leaves buffers untouched whose channel layout does not match the per-channel state
+    if (target_buffer.channel_count != int(filter_state.previous_input.size())) {
+        return;
+    }
+    int frame_total = frames_per_channel(target_buffer);
+    const double pole_coefficient = filter_state.pole_coefficient;
+
+    // The system lays channel groups side by side in stack scratch so the recursion runs across SIMD lanes
+    double lane_samples[PROCESSING_SUB_BLOCK_SIZE][SIMD_LANE_COUNT];
+
+    for (int group_start = 0; group_start < target_buffer.channel_count; group_start += SIMD_LANE_COUNT) {
+        int group_width = min(SIMD_LANE_COUNT, target_buffer.channel_count - group_start);
+
+        // The system loads recursion state for the group, leaving unused lanes at zero
+        double previous_input[SIMD_LANE_COUNT] = {0.0};
+        double previous_output[SIMD_LANE_COUNT] = {0.0};
+        double running_sum[SIMD_LANE_COUNT] = {0.0};
+        for (int lane_index = 0; lane_index < group_width; lane_index++) {
+            previous_input[lane_index] = filter_state.previous_input[group_start + lane_index];
+            previous_output[lane_index] = filter_state.previous_output[group_start + lane_index];
+        }
+
+        for (int block_start = 0; block_start < frame_total; block_start += PROCESSING_SUB_BLOCK_SIZE) {
+            int block_length = min(PROCESSING_SUB_BLOCK_SIZE, frame_total - block_start);
+
+            // The system transposes the planar sub-block into lane-interleaved scratch
+            load_channel_lanes(target_buffer, group_start, group_width, block_start, block_length, lane_samples);
+
+            // The system advances every lane's estimator and recursion together one frame at a time
+            for (int frame_index = 0; frame_index < block_length; frame_index++) {
+                for (int lane_index = 0; lane_index < SIMD_LANE_COUNT; lane_index++) {
+                    double input_sample = lane_samples[frame_index][lane_index];
+                    double output_sample = input_sample - previous_input[lane_index] +
+                                           pole_coefficient * previous_output[lane_index];
+                    running_sum[lane_index] += input_sample;
+                    previous_input[lane_index] = input_sample;
+                    previous_output[lane_index] = output_sample;
+                    lane_samples[frame_index][lane_index] = output_sample;
+                }
+            }
+
+            // The system writes filtered samples back to their planes when removal is requested
+            if (filter_state.removal_enabled) {
+                store_channel_lanes(target_buffer, group_start, group_width, block_start, block_length, lane_samples);
+            }
+        }
+
+        // The system stores recursion state and running sums for the next block
+        for (int lane_index = 0; lane_index < group_width; lane_index++) {
+            filter_state.previous_input[group_start + lane_index] = previous_input[lane_index];
+            filter_state.previous_output[group_start + lane_index] = previous_output[lane_index];
+            filter_state.channel_sample_sum[group_start + lane_index] += running_sum[lane_index];
+        }
+    }
+
+    filter_state.estimated_frame_count += frame_total;
+}
+
+// Enumeration of analysis window shapes available as compile-time tables
+enum window_shape {
+    WINDOW_HANN,                              // Periodic raised cosine
+    WINDOW_HAMMING,                           // Raised cosine on a pedestal
+    WINDOW_BLACKMAN_HARRIS,                   // Four-term minimum sidelobe window
+    WINDOW_KAISER,                            // Bessel window with adjustable sidelobe level
+    WINDOW_SQRT_HANN                          // Square-root Hann for weighted overlap-add
+};
+
+// Structure definition for a fixed-size table that can be filled during constant evaluation
+template <typename value_type, int TABLE_SIZE>
+struct fixed_size_table {
+    value_type values[TABLE_SIZE] = {};      // Table entries stored directly in the binary
+
+    constexpr value_type& operator[](int entry_index) { return values[entry_index]; }
+    constexpr const value_type& operator[](int entry_index) const { return values[entry_index]; }
+};
+
+// Transform size covered by the compile-time twiddle table (the partitioned convolver size)
+constexpr int COMPILE_TIME_FFT_SIZE = 2 * AUDIO_BUFFER_SIZE;
+
+// Function declaration for sine evaluation on the reduced interval [-pi/4, pi/4]
+constexpr double constexpr_sine_kernel(double reduced_angle) {
+    double squared_angle = reduced_angle * reduced_angle;
+    double series_term = reduced_angle;
+    double series_sum = reduced_angle;
+    for (int term_index = 1; term_index <= 12; term_index++) {
+        series_term *= -squared_angle / ((2.0 * term_index) * (2.0 * term_index + 1.0));
+        series_sum += series_term;
+    }
+    return series_sum;                         // Function returns sine of the reduced angle
+}
+
+// Function declaration for cosine evaluation on the reduced interval [-pi/4, pi/4]
+constexpr double constexpr_cosine_kernel(double reduced_angle) {
+    double squared_angle = reduced_angle * reduced_angle;
+    double series_term = 1.0;
+    double series_sum = 1.0;
+    for (int term_index = 1; term_index <= 12; term_index++) {
+        series_term *= -squared_angle / ((2.0 * term_index - 1.0) * (2.0 * term_index));
+        series_sum += series_term;
+    }
+    return series_sum;                         // Function returns cosine of the reduced angle
+}
+
+// Function declaration for quadrant evaluation shared by compile-time sine and cosine
+constexpr double constexpr_quadrant_value(double angle_value, int quadrant_shift) {
+    // The system reduces by pi/2 in two parts so large table angles keep full precision
+    constexpr double HALF_PI_HIGH = 1.5707963267948966;
+    constexpr double HALF_PI_LOW = 6.123233995736766e-17;
+    double quadrant_estimate = angle_value / HALF_PI_HIGH;
+    long long quadrant_index = (long long)(quadrant_estimate >= 0.0 ? quadrant_estimate + 0.5 : quadrant_estimate - 0.5);
+    double reduced_angle = (angle_value - double(quadrant_index) * HALF_PI_HIGH) - double(quadrant_index) * HALF_PI_LOW;
+    switch (((quadrant_index + quadrant_shift) % 4 + 4) % 4) {
+        case 0: return constexpr_sine_kernel(reduced_angle);
+        case 1: return constexpr_cosine_kernel(reduced_angle);
+        case 2: return -constexpr_sine_kernel(reduced_angle);
+        default: return -constexpr_cosine_kernel(reduced_angle);
+    }
+}
+
+// Function declaration for compile-time sine
+constexpr double constexpr_sin(double angle_value) {
+    return constexpr_quadrant_value(angle_value, 0);
+}
+
+// Function declaration for compile-time cosine
+constexpr double constexpr_cos(double angle_value) {
+    return constexpr_quadrant_value(angle_value, 1);
+}
+
+// Function declaration for compile-time square root by Newton iteration from above
+constexpr double constexpr_sqrt(double argument_value) {
+    if (argument_value <= 0.0) {
+        return 0.0;
+    }
+    double root_estimate = argument_value > 1.0 ? argument_value : 1.0;
+    for (int iteration_index = 0; iteration_index < 128; iteration_index++) {
+        double refined_estimate = 0.5 * (root_estimate + argument_value / root_estimate);
+        if (refined_estimate >= root_estimate) {
+            break;
+        }
+        root_estimate = refined_estimate;
+    }
+    return root_estimate;                      // Function returns the converged root
+}
+
+// Function declaration for compile-time exponential with power-of-two range reduction
+constexpr double constexpr_exp(double argument_value) {
+    constexpr double LN2_HIGH = 0.6931471805599453;
+    constexpr double LN2_LOW = 2.3190468138462996e-17;
+    double octave_estimate = argument_value / LN2_HIGH;
+    long long octave_index = (long long)(octave_estimate >= 0.0 ? octave_estimate + 0.5 : octave_estimate - 0.5);
+    double reduced_argument = (argument_value - double(octave_index) * LN2_HIGH) - double(octave_index) * LN2_LOW;
+    double series_term = 1.0;
+    double series_sum = 1.0;
+    for (int term_index = 1; term_index <= 20; term_index++) {
+        series_term *= reduced_argument / term_index;
+        series_sum += series_term;
+    }
+    for (long long octave_step = 0; octave_step < octave_index; octave_step++) {
+        series_sum *= 2.0;
+    }
+    for (long long octave_step = 0; octave_step > octave_index; octave_step--) {
+        series_sum *= 0.5;
+    }
+    return series_sum;                         // Function returns e raised to the argument
+}
+
+// Function declaration for zeroth-order modified Bessel function evaluation
+constexpr double modified_bessel_i0(double argument_value) {
+    // The system sums the power series until terms become negligible
+    double series_sum = 1.0;
+    double series_term = 1.0;
+    double half_argument = 0.5 * argument_value;
+    for (int term_index = 1; term_index < 64 && series_term > 1e-16 * series_sum; term_index++) {
+        series_term *= (half_argument / term_index) * (half_argument / term_index);
+        series_sum += series_term;
+    }
+    return series_sum;                         // Function returns I0 of the argument
+}
+
+// Function declaration for compile-time analysis window generation
+template <int WINDOW_LENGTH>
+constexpr fixed_size_table<double, WINDOW_LENGTH> generate_window_table(window_shape shape, double kaiser_beta = 8.6) {
+    fixed_size_table<double, WINDOW_LENGTH> window_table;
+    for (int sample_index = 0; sample_index < WINDOW_LENGTH; sample_index++) {
+        double cycle_angle = 2.0 * M_PI * sample_index / WINDOW_LENGTH;
+        switch (shape) {
+            case WINDOW_HANN:
+                window_table[sample_index] = 0.5 - 0.5 * constexpr_cos(cycle_angle);
+                break;
+            case WINDOW_HAMMING:
+                window_table[sample_index] = 0.54 - 0.46 * constexpr_cos(cycle_angle);
+                break;
+            case WINDOW_BLACKMAN_HARRIS:
+                window_table[sample_index] = 0.35875 - 0.48829 * constexpr_cos(cycle_angle) +
+                                             0.14128 * constexpr_cos(2.0 * cycle_angle) - 0.01168 * constexpr_cos(3.0 * cycle_angle);
+                break;
+            case WINDOW_KAISER: {
+                double window_position = 2.0 * sample_index / (WINDOW_LENGTH - 1) - 1.0;
+                window_table[sample_index] = modified_bessel_i0(kaiser_beta * constexpr_sqrt(1.0 - window_position * window_position)) /
+                                             modified_bessel_i0(kaiser_beta);
+                break;
+            }
+            case WINDOW_SQRT_HANN:
+                window_table[sample_index] = constexpr_sin(0.5 * cycle_angle);
+                break;
+        }
+    }
+    return window_table;                       // Function returns the populated window
+}
+
+// Function declaration for compile-time forward twiddle generation over the first half circle
+template <int TRANSFORM_SIZE>
+constexpr fixed_size_table<double, TRANSFORM_SIZE / 2> generate_twiddle_table(bool imaginary_part) {
+    fixed_size_table<double, TRANSFORM_SIZE / 2> twiddle_table;
+    for (int twiddle_index = 0; twiddle_index < TRANSFORM_SIZE / 2; twiddle_index++) {
+        double twiddle_angle = -2.0 * M_PI * twiddle_index / TRANSFORM_SIZE;
+        twiddle_table[twiddle_index] = imaginary_part ? constexpr_sin(twiddle_angle) : constexpr_cos(twiddle_angle);
+    }
+    return twiddle_table;                      // Function returns the populated twiddles
+}
+
+// Function declaration for compile-time bit-reversal permutation generation
+template <int TRANSFORM_SIZE>
+constexpr fixed_size_table<int, TRANSFORM_SIZE> generate_bit_reversal_table() {
+    fixed_size_table<int, TRANSFORM_SIZE> reversal_table;
+    int log2_size = 0;
+    while ((1 << log2_size) < TRANSFORM_SIZE) {
+        log2_size++;
+    }
+    for (int point_index = 0; point_index < TRANSFORM_SIZE; point_index++) {
+        int reversed_index = 0;
+        for (int bit_index = 0; bit_index < log2_size; bit_index++) {
+            reversed_index |= ((point_index >> bit_index) & 1) << (log2_size - 1 - bit_index);
+        }
+        reversal_table[point_index] = reversed_index;
+    }
+    return reversal_table;                     // Function returns the populated permutation
+}
+
+// Tables evaluated by the compiler and stored in read-only data, so startup builds nothing for these sizes
+constexpr auto HANN_WINDOW_TABLE = generate_window_table<AUDIO_BUFFER_SIZE>(WINDOW_HANN);
+constexpr auto HAMMING_WINDOW_TABLE = generate_window_table<AUDIO_BUFFER_SIZE>(WINDOW_HAMMING);
+constexpr auto BLACKMAN_HARRIS_WINDOW_TABLE = generate_window_table<AUDIO_BUFFER_SIZE>(WINDOW_BLACKMAN_HARRIS);
+constexpr auto KAISER_WINDOW_TABLE = generate_window_table<AUDIO_BUFFER_SIZE>(WINDOW_KAISER);
+constexpr auto SQRT_HANN_WINDOW_TABLE = generate_window_table<AUDIO_BUFFER_SIZE>(WINDOW_SQRT_HANN);
+constexpr auto FFT_TWIDDLE_REAL_TABLE = generate_twiddle_table<COMPILE_TIME_FFT_SIZE>(false);
+constexpr auto FFT_TWIDDLE_IMAG_TABLE = generate_twiddle_table<COMPILE_TIME_FFT_SIZE>(true);
+
+// Function declaration for biquad coefficient design at the global sampling frequency
+constexpr biquad_coefficients design_biquad_coefficients(const biquad_band_specification& band_specification) {
+    // The system evaluates the audio EQ cookbook intermediate terms with constexpr math so fixed designs are baked
+    double angular_frequency = 2.0 * M_PI * band_specification.frequency_hz / SAMPLE_RATE;
+    double cosine_term = constexpr_cos(angular_frequency);
+    double alpha_term = constexpr_sin(angular_frequency) / (2.0 * max(band_specification.quality_factor, 1e-3));
+    double shelf_amplitude = constexpr_exp(band_specification.gain_db / 40.0 * 2.302585092994046);
+    double shelf_root = 2.0 * constexpr_sqrt(shelf_amplitude) * alpha_term;
+
+    double b0 = 1.0, b1 = 0.0, b2 = 0.0, a0 = 1.0, a1 = 0.0, a2 = 0.0;
+    switch (band_specification.filter_type) {
+        case BIQUAD_PEAKING:
+            b0 = 1.0 + alpha_term * shelf_amplitude;
+            b1 = -2.0 * cosine_term;
+            b2 = 1.0 - alpha_term * shelf_amplitude;
+            a0 = 1.0 + alpha_term / shelf_amplitude;
+            a1 = -2.0 * cosine_term;
+            a2 = 1.0 - alpha_term / shelf_amplitude;
+            break;
+        case BIQUAD_LOW_SHELF:
+            b0 = shelf_amplitude * ((shelf_amplitude + 1.0) - (shelf_amplitude - 1.0) * cosine_term + shelf_root);
+            b1 = 2.0 * shelf_amplitude * ((shelf_amplitude - 1.0) - (shelf_amplitude + 1.0) * cosine_term);
+            b2 = shelf_amplitude * ((shelf_amplitude + 1.0) - (shelf_amplitude - 1.0) * cosine_term - shelf_root);
+            a0 = (shelf_amplitude + 1.0) + (shelf_amplitude - 1.0) * cosine_term + shelf_root;
+            a1 = -2.0 * ((shelf_amplitude - 1.0) + (shelf_amplitude + 1.0) * cosine_term);
+            a2 = (shelf_amplitude + 1.0) + (shelf_amplitude - 1.0) * cosine_term - shelf_root;
+            break;
+        case BIQUAD_HIGH_SHELF:
+            b0 = shelf_amplitude * ((shelf_amplitude + 1.0) + (shelf_amplitude - 1.0) * cosine_term + shelf_root);
+            b1 = -2.0 * shelf_amplitude * ((shelf_amplitude - 1.0) + (shelf_amplitude + 1.0) * cosine_term);
+            b2 = shelf_amplitude * ((shelf_amplitude + 1.0) + (shelf_amplitude - 1.0) * cosine_term - shelf_root);
+            a0 = (shelf_amplitude + 1.0) - (shelf_amplitude - 1.0) * cosine_term + shelf_root;
+            a1 = 2.0 * ((shelf_amplitude - 1.0) - (shelf_amplitude + 1.0) * cosine_term);
+            a2 = (shelf_amplitude + 1.0) - (shelf_amplitude - 1.0) * cosine_term - shelf_root;
+            break;
+        case BIQUAD_LOW_PASS:
+            b0 = 0.5 * (1.0 - cosine_term);
+            b1 = 1.0 - cosine_term;
+            b2 = 0.5 * (1.0 - cosine_term);
+            a0 = 1.0 + alpha_term;
+            a1 = -2.0 * cosine_term;
+            a2 = 1.0 - alpha_term;
+            break;
+        case BIQUAD_HIGH_PASS:
+            b0 = 0.5 * (1.0 + cosine_term);
+            b1 = -(1.0 + cosine_term);
+            b2 = 0.5 * (1.0 + cosine_term);
+            a0 = 1.0 + alpha_term;
+            a1 = -2.0 * cosine_term;
+            a2 = 1.0 - alpha_term;
+            break;
+    }
+
+    // The system normalises every coefficient by the leading feedback term
+    return {b0 / a0, b1 / a0, b2 / a0, a1 / a0, a2 / a0};
+}
+
+// Function declaration for parametric equalizer initialization and coefficient design
+parametric_equalizer_state initialize_parametric_equalizer(const vector<biquad_band_specification>& band_specifications,
+                                                           int channel_count) {
+    parametric_equalizer_state equalizer_state; // Local state structure instance
+
+    // The system designs each section once so the processing loop only reads coefficients
+    equalizer_state.section_count = min(int(band_specifications.size()), MAXIMUM_EQUALIZER_SECTIONS);
+    equalizer_state.dropped_band_count = int(band_specifications.size()) - equalizer_state.section_count;
+    for (int section_index = 0; section_index < equalizer_state.section_count; section_index++) {
+        equalizer_state.section_coefficients[section_index] = design_biquad_coefficients(band_specifications[section_index]);
+    }
+
+    // The system allocates filter memory for every channel up front
+    equalizer_state.section_memory.assign(size_t(channel_count) * MAXIMUM_EQUALIZER_SECTIONS * 2, 0.0);
+
+    return equalizer_state;                    // Function returns prepared equalizer state
+}
+
+// Function declaration for in-place cascaded biquad filtering with channels in SIMD lanes
+void apply_parametric_equalizer(audio_processing_buffer& target_buffer, parametric_equalizer_state& equalizer_state) {
+    // The system leaves buffers untouched that have more channels than the allocated filter memory
+    if (size_t(max(target_buffer.channel_count, 0)) * MAXIMUM_EQUALIZER_SECTIONS * 2 > equalizer_state.section_memory.size()) {
+        return;
+    }
+    int frame_total = frames_per_channel(target_buffer);
+    double lane_samples[PROCESSING_SUB_BLOCK_SIZE][SIMD_LANE_COUNT];
+
+    for (int group_start = 0; group_start < target_buffer.channel_count; group_start += SIMD_LANE_COUNT) {
+        int group_width = min(SIMD_LANE_COUNT, target_buffer.channel_count - group_start);
+
+        // The system loads transposed direct-form II memory for every section of the channel group
+        double first_state[MAXIMUM_EQUALIZER_SECTIONS][SIMD_LANE_COUNT] = {{0.0}};
+        double second_state[MAXIMUM_EQUALIZER_SECTIONS][SIMD_LANE_COUNT] = {{0.0}};
+        for (int section_index = 0; section_index < equalizer_state.section_count; section_index++) {
+            for (int lane_index = 0; lane_index < group_width; lane_index++) {
+                size_t memory_offset = (size_t(group_start + lane_index) * MAXIMUM_EQUALIZER_SECTIONS + section_index) * 2;
+                first_state[section_index][lane_index] = equalizer_state.section_memory[memory_offset];
+                second_state[section_index][lane_index] = equalizer_state.section_memory[memory_offset + 1];
+            }
+        }
+
+        for (int block_start = 0; block_start < frame_total; block_start += PROCESSING_SUB_BLOCK_SIZE) {
+            int block_length = min(PROCESSING_SUB_BLOCK_SIZE, frame_total - block_start);
+            load_channel_lanes(target_buffer, group_start, group_width, block_start, block_length, lane_samples);
+
+            // The system runs each section over the sub-block with all channels advancing in lockstep
+            for (int section_index = 0; section_index < equalizer_state.section_count; section_index++) {
+                const biquad_coefficients coefficients = equalizer_state.section_coefficients[section_index];
+                double* z1 = first_state[section_index];
+                double* z2 = second_state[section_index];
+                for (int frame_index = 0; frame_index < block_length; frame_index++) {
+                    for (int lane_index = 0; lane_index < SIMD_LANE_COUNT; lane_index++) {
+                        double input_sample = lane_samples[frame_index][lane_index];
+                        double output_sample = coefficients.b0 * input_sample + z1[lane_index];
+                        z1[lane_index] = coefficients.b1 * input_sample - coefficients.a1 * output_sample + z2[lane_index];
+                        z2[lane_index] = coefficients.b2 * input_sample - coefficients.a2 * output_sample;
+                        lane_samples[frame_index][lane_index] = output_sample;
+                    }
+                }
+            }
+
+            store_channel_lanes(target_buffer, group_start, group_width, block_start, block_length, lane_samples);
+        }
+
+        // The system stores section memory for the next block
+        for (int section_index = 0; section_index < equalizer_state.section_count; section_index++) {
+            for (int lane_index = 0; lane_index < group_width; lane_index++) {
+                size_t memory_offset = (size_t(group_start + lane_index) * MAXIMUM_EQUALIZER_SECTIONS + section_index) * 2;
+                equalizer_state.section_memory[memory_offset] = first_state[section_index][lane_index];
+                equalizer_state.section_memory[memory_offset + 1] = second_state[section_index][lane_index];
+            }
+        }
+    }
+}
+
+// Function declaration for radix-2 transform plan construction
+fft_transform_plan create_fft_plan(int transform_size) {
+    fft_transform_plan transform_plan;         // Local plan structure instance
+    transform_plan.transform_size = transform_size;
+
+    // The system computes the bit-reversed index permutation
+    int log2_size = 0;
+    while ((1 << log2_size) < transform_size) {
+        log2_size++;
+    }
+    transform_plan.bit_reversal_order.resize(transform_size);
+    for (int point_index = 0; point_index < transform_size; point_index++) {
+        int reversed_index = 0;
+        for (int bit_index = 0; bit_index < log2_size; bit_index++) {
+            reversed_index |= ((point_index >> bit_index) & 1) << (log2_size - 1 - bit_index);
+        }
+        transform_plan.bit_reversal_order[point_index] = reversed_index;
+    }
+
+    // The system tabulates forward twiddle factors, striding the baked table when it covers this size
+    transform_plan.twiddle_real.resize(transform_size / 2);
+    transform_plan.twiddle_imag.resize(transform_size / 2);
+    for (int twiddle_index = 0; twiddle_index < transform_size / 2; twiddle_index++) {
+        if (transform_size <= COMPILE_TIME_FFT_SIZE) {
+            int baked_index = twiddle_index * (COMPILE_TIME_FFT_SIZE / transform_size);
+            transform_plan.twiddle_real[twiddle_index] = FFT_TWIDDLE_REAL_TABLE[baked_index];
+            transform_plan.twiddle_imag[twiddle_index] = FFT_TWIDDLE_IMAG_TABLE[baked_index];
+        } else {
+            double twiddle_angle = -2.0 * M_PI * twiddle_index / transform_size;
+            transform_plan.twiddle_real[twiddle_index] = cos(twiddle_angle);
+            transform_plan.twiddle_imag[twiddle_index] = sin(twiddle_angle);
+        }
+    }
+
+    return transform_plan;                     // Function returns constructed transform plan
+}
+
+// Function declaration for shared transform plan lookup with one-time construction per size
+const fft_transform_plan& acquire_fft_plan(int transform_size) {
+    // The system keeps plans alive for the whole program so every stage shares one instance per size
+    static map<int, fft_transform_plan> plan_cache;
+    static mutex plan_cache_mutex;
+    lock_guard<mutex> cache_lock(plan_cache_mutex);
+    auto cached_plan = plan_cache.find(transform_size);
+    if (cached_plan == plan_cache.end()) {
+        cached_plan = plan_cache.emplace(transform_size, create_fft_plan(transform_size)).first;
+    }
+    return cached_plan->second;                // Function returns the cached plan
+}
+
+// Function declaration for a constant-size split-complex transform driven entirely by baked tables
+template <int TRANSFORM_SIZE>
+void execute_fixed_size_fft(double* real_part, double* imag_part, bool inverse_transform) {
+    static_assert((TRANSFORM_SIZE & (TRANSFORM_SIZE - 1)) == 0 && TRANSFORM_SIZE <= COMPILE_TIME_FFT_SIZE,
+                  "fixed-size transforms must be powers of two covered by the baked twiddle table");
+    static constexpr auto BIT_REVERSAL_TABLE = generate_bit_reversal_table<TRANSFORM_SIZE>();
+    constexpr int TWIDDLE_SCALE = COMPILE_TIME_FFT_SIZE / TRANSFORM_SIZE;
+
+    for (int point_index = 0; point_index < TRANSFORM_SIZE; point_index++) {
+        int reversed_index = BIT_REVERSAL_TABLE[point_index];
+        if (reversed_index > point_index) {
+            swap(real_part[point_index], real_part[reversed_index]);
+            swap(imag_part[point_index], imag_part[reversed_index]);
+        }
+    }
+
+    // The system runs the twiddle-free first stage separately, then unrollable fixed-bound stages
+    for (int group_start = 0; group_start < TRANSFORM_SIZE; group_start += 2) {
+        double lower_re = real_part[group_start + 1];
+        double lower_im = imag_part[group_start + 1];
+        real_part[group_start + 1] = real_part[group_start] - lower_re;
+        imag_part[group_start + 1] = imag_part[group_start] - lower_im;
+        real_part[group_start] += lower_re;
+        imag_part[group_start] += lower_im;
+    }
+    double direction_sign = inverse_transform ? -1.0 : 1.0;
+    for (int span_length = 4; span_length <= TRANSFORM_SIZE; span_length <<= 1) {
+        int half_span = span_length / 2;
+        int twiddle_stride = (TRANSFORM_SIZE / span_length) * TWIDDLE_SCALE;
+        for (int group_start = 0; group_start < TRANSFORM_SIZE; group_start += span_length) {
+            double* upper_re = real_part + group_start;
+            double* upper_im = imag_part + group_start;
+            double* lower_re = upper_re + half_span;
+            double* lower_im = upper_im + half_span;
+            for (int butterfly_index = 0; butterfly_index < half_span; butterfly_index++) {
+                double twiddle_re = FFT_TWIDDLE_REAL_TABLE[butterfly_index * twiddle_stride];
+                double twiddle_im = direction_sign * FFT_TWIDDLE_IMAG_TABLE[butterfly_index * twiddle_stride];
+                double product_re = lower_re[butterfly_index] * twiddle_re - lower_im[butterfly_index] * twiddle_im;
+                double product_im = lower_re[butterfly_index] * twiddle_im + lower_im[butterfly_index] * twiddle_re;
+                lower_re[butterfly_index] = upper_re[butterfly_index] - product_re;
+                lower_im[butterfly_index] = upper_im[butterfly_index] - product_im;
+                upper_re[butterfly_index] += product_re;
+                upper_im[butterfly_index] += product_im;
+            }
+        }
+    }
+
+    if (inverse_transform) {
+        constexpr double NORMALISATION = 1.0 / TRANSFORM_SIZE;
+        for (int point_index = 0; point_index < TRANSFORM_SIZE; point_index++) {
+            real_part[point_index] *= NORMALISATION;
+            imag_part[point_index] *= NORMALISATION;
+        }
+    }
+}
+
+// Function declaration for plan-driven split-complex transform execution at any power-of-two size
+void execute_planned_fft(const fft_transform_plan& transform_plan, double* real_part, double* imag_part, bool inverse_transform) {
+    int transform_size = transform_plan.transform_size;
+
+    // The system applies the bit-reversal permutation by pairwise swaps
+    for (int point_index = 0; point_index < transform_size; point_index++) {
+        int reversed_index = transform_plan.bit_reversal_order[point_index];
+        if (reversed_index > point_index) {
+            swap(real_part[point_index], real_part[reversed_index]);
+            swap(imag_part[point_index], imag_part[reversed_index]);
+        }
+    }
+
+    // The system combines butterflies stage by stage, conjugating twiddles for the inverse
+    double direction_sign = inverse_transform ? -1.0 : 1.0;
+    for (int span_length = 2; span_length <= transform_size; span_length <<= 1) {
+        int half_span = span_length / 2;
+        int twiddle_stride = transform_size / span_length;
+        for (int group_start = 0; group_start < transform_size; group_start += span_length) {
+            for (int butterfly_index = 0; butterfly_index < half_span; butterfly_index++) {
+                double twiddle_re = transform_plan.twiddle_real[butterfly_index * twiddle_stride];
+                double twiddle_im = direction_sign * transform_plan.twiddle_imag[butterfly_index * twiddle_stride];
+                int upper_index = group_start + butterfly_index;
+                int lower_index = upper_index + half_span;
+                double product_re = real_part[lower_index] * twiddle_re - imag_part[lower_index] * twiddle_im;
+                double product_im = real_part[lower_index] * twiddle_im + imag_part[lower_index] * twiddle_re;
+                real_part[lower_index] = real_part[upper_index] - product_re;
+                imag_part[lower_index] = imag_part[upper_index] - product_im;
+                real_part[upper_index] += product_re;
+                imag_part[upper_index] += product_im;
+            }
+        }
+    }
+
+    // The system normalises the inverse transform so a round trip is the identity
+    if (inverse_transform) {
+        double normalisation = 1.0 / transform_size;
+        for (int point_index = 0; point_index < transform_size; point_index++) {
+            real_part[point_index] *= normalisation;
+            imag_part[point_index] *= normalisation;
+        }
+    }
+}
+
+// Function declaration for in-place split-complex fast Fourier transform execution
+void execute_fft(const fft_transform_plan& transform_plan, double* real_part, double* imag_part, bool inverse_transform) {
+    // The system routes the sizes used by the convolver, noise reducer and stretcher to constant-size kernels
+    switch (transform_plan.transform_size) {
+        case COMPILE_TIME_FFT_SIZE:
+            execute_fixed_size_fft<COMPILE_TIME_FFT_SIZE>(real_part, imag_part, inverse_transform);
+            break;
+        case AUDIO_BUFFER_SIZE:
+            execute_fixed_size_fft<AUDIO_BUFFER_SIZE>(real_part, imag_part, inverse_transform);
+            break;
+        default:
+            execute_planned_fft(transform_plan, real_part, imag_part, inverse_transform);
+            break;
+    }
+}
+
+// Function declaration for partitioned convolver initialization from an impulse response
+partitioned_convolver_state initialize_partitioned_convolver(const vector<double>& impulse_response, int channel_count) {
+    partitioned_convolver_state convolver_state; // Local state structure instance
+
+    // The system matches the partition length to the standard buffer size
+    int block_size = AUDIO_BUFFER_SIZE;
+    int transform_size = 2 * block_size;
+    convolver_state.block_size = block_size;
+    convolver_state.partition_count = max(1, int((impulse_response.size() + block_size - 1) / block_size));
+    convolver_state.spectrum_bins = block_size + 1;
+    convolver_state.channel_count = channel_count;
+    convolver_state.transform_plan = &acquire_fft_plan(transform_size);
+
+    // The system transforms each zero-padded impulse response partition once
+    size_t spectra_size = size_t(convolver_state.partition_count) * convolver_state.spectrum_bins;
+    convolver_state.filter_spectra_real.assign(spectra_size, 0.0);
+    convolver_state.filter_spectra_imag.assign(spectra_size, 0.0);
+    convolver_state.transform_real.assign(transform_size, 0.0);
+    convolver_state.transform_imag.assign(transform_size, 0.0);
+    for (int partition_index = 0; partition_index < convolver_state.partition_count; partition_index++) {
+        fill(convolver_state.transform_real.begin(), convolver_state.transform_real.end(), 0.0);
+        fill(convolver_state.transform_imag.begin(), convolver_state.transform_imag.end(), 0.0);
+        for (int tap_index = 0; tap_index < block_size; tap_index++) {
+            size_t source_index = size_t(partition_index) * block_size + tap_index;
+            if (source_index < impulse_response.size()) {
+                convolver_state.transform_real[tap_index] = impulse_response[source_index];
+            }
+        }
+        execute_fft(*convolver_state.transform_plan, convolver_state.transform_real.data(),
+                    convolver_state.transform_imag.data(), false);
+        size_t spectrum_offset = size_t(partition_index) * convolver_state.spectrum_bins;
+        copy(convolver_state.transform_real.begin(), convolver_state.transform_real.begin() + convolver_state.spectrum_bins,
+             convolver_state.filter_spectra_real.begin() + spectrum_offset);
+        copy(convolver_state.transform_imag.begin(), convolver_state.transform_imag.begin() + convolver_state.spectrum_bins,
+             convolver_state.filter_spectra_imag.begin() + spectrum_offset);
+    }
+
+    // The system allocates the frequency-domain delay line and time-domain staging per channel
+    convolver_state.delay_line_real.assign(size_t(channel_count) * spectra_size, 0.0);
+    convolver_state.delay_line_imag.assign(size_t(channel_count) * spectra_size, 0.0);
+    convolver_state.delay_line_head = 0;
+    convolver_state.input_history.assign(size_t(channel_count) * transform_size, 0.0);
+    convolver_state.output_block.assign(size_t(channel_count) * block_size, 0.0);
+    convolver_state.block_fill_position = 0;
+    convolver_state.accumulator_real.assign(convolver_state.spectrum_bins, 0.0);
+    convolver_state.accumulator_imag.assign(convolver_state.spectrum_bins, 0.0);
+
+    return convolver_state;                    // Function returns prepared convolver state
+}
+
+// Function declaration for one overlap-save partition step over a completed input block
+void convolve_completed_block(partitioned_convolver_state& convolver_state) {
+    int block_size = convolver_state.block_size;
+    int transform_size = 2 * block_size;
+    int spectrum_bins = convolver_state.spectrum_bins;
+    size_t spectra_size = size_t(convolver_state.partition_count) * spectrum_bins;
+
+    // The system advances the delay line so the newest spectrum occupies the head slot
+    convolver_state.delay_line_head = (convolver_state.delay_line_head + convolver_state.partition_count - 1) %
+                                      convolver_state.partition_count;
+
+    for (int channel_index = 0; channel_index < convolver_state.channel_count; channel_index++) {
+        double* input_history = convolver_state.input_history.data() + size_t(channel_index) * transform_size;
+        double* delay_real = convolver_state.delay_line_real.data() + size_t(channel_index) * spectra_size;
+        double* delay_imag = convolver_state.delay_line_imag.data() + size_t(channel_index) * spectra_size;
+        double* transform_real = convolver_state.transform_real.data();
+        double* transform_imag = convolver_state.transform_imag.data();
+
+        // The system transforms the sliding window of previous and current input blocks
+        copy(input_history, input_history + transform_size, transform_real);
+        fill(transform_imag, transform_imag + transform_size, 0.0);
+        execute_fft(*convolver_state.transform_plan, transform_real, transform_imag, false);
+        size_t head_offset = size_t(convolver_state.delay_line_head) * spectrum_bins;
+        copy(transform_real, transform_real + spectrum_bins, delay_real + head_offset);
+        copy(transform_imag, transform_imag + spectrum_bins, delay_imag + head_offset);
+
+        // The system multiplies and accumulates every delayed spectrum with its partition spectrum
+        double* accumulator_real = convolver_state.accumulator_real.data();
+        double* accumulator_imag = convolver_state.accumulator_imag.data();
+        fill(accumulator_real, accumulator_real + spectrum_bins, 0.0);
+        fill(accumulator_imag, accumulator_imag + spectrum_bins, 0.0);
+        for (int partition_index = 0; partition_index < convolver_state.partition_count; partition_index++) {
+            int slot_index = (convolver_state.delay_line_head + partition_index) % convolver_state.partition_count;
+            const double* input_real = delay_real + size_t(slot_index) * spectrum_bins;
+            const double* input_imag = delay_imag + size_t(slot_index) * spectrum_bins;
+            const double* filter_real = convolver_state.filter_spectra_real.data() + size_t(partition_index) * spectrum_bins;
+            const double* filter_imag = convolver_state.filter_spectra_imag.data() + size_t(partition_index) * spectrum_bins;
+            for (int bin_index = 0; bin_index < spectrum_bins; bin_index++) {
+                accumulator_real[bin_index] += input_real[bin_index] * filter_real[bin_index] -
+                                               input_imag[bin_index] * filter_imag[bin_index];
+                accumulator_imag[bin_index] += input_real[bin_index] * filter_imag[bin_index] +
+                                               input_imag[bin_index] * filter_real[bin_index];
+            }
+        }
+
+        // The system restores the redundant half by conjugate symmetry and returns to the time domain
+        copy(accumulator_real, accumulator_real + spectrum_bins, transform_real);
+        copy(accumulator_imag, accumulator_imag + spectrum_bins, transform_imag);
+        for (int bin_index = spectrum_bins; bin_index < transform_size; bin_index++) {
+            transform_real[bin_index] = accumulator_real[transform_size - bin_index];
+            transform_imag[bin_index] = -accumulator_imag[transform_size - bin_index];
+        }
+        execute_fft(*convolver_state.transform_plan, transform_real, transform_imag, true);
+
+        // The system keeps the alias-free second half and slides the input window forward
+        copy(transform_real + block_size, transform_real + transform_size,
+             convolver_state.output_block.begin() + size_t(channel_index) * block_size);
+        copy(input_history + block_size, input_history + transform_size, input_history);
+    }
+}
+
+// Function declaration for in-place streaming partitioned convolution with one block of latency
+void apply_partitioned_convolver(audio_processing_buffer& target_buffer, partitioned_convolver_state& convolver_state) {
+    // The system leaves buffers untouched whose channel layout does not match the per-channel state,
+    // since unconvolved channels would miss the one-block latency and drift out of alignment
+    if (target_buffer.channel_count != convolver_state.channel_count) {
+        return;
+    }
+    int frame_total = frames_per_channel(target_buffer);
+    int block_size = convolver_state.block_size;
+    int channel_total = convolver_state.channel_count;
+    int frame_position = 0;
+
+    // Iterative loop exchanges input for delayed output until a partition block completes
+    while (frame_position < frame_total) {
+        int exchange_length = min(block_size - convolver_state.block_fill_position, frame_total - frame_position);
+        for (int channel_index = 0; channel_index < channel_total; channel_index++) {
+            double* channel_plane = access_channel_plane(target_buffer, channel_index) + frame_position;
+            double* history_slot = convolver_state.input_history.data() + size_t(channel_index) * 2 * block_size +
+                                   block_size + convolver_state.block_fill_position;
+            const double* output_slot = convolver_state.output_block.data() + size_t(channel_index) * block_size +
+                                        convolver_state.block_fill_position;
+            for (int frame_index = 0; frame_index < exchange_length; frame_index++) {
+                history_slot[frame_index] = channel_plane[frame_index];
+                channel_plane[frame_index] = output_slot[frame_index];
+            }
+        }
+        convolver_state.block_fill_position += exchange_length;
+        frame_position += exchange_length;
+
+        // The system runs the frequency-domain step whenever a full block has been gathered
+        if (convolver_state.block_fill_position == block_size) {
+            convolve_completed_block(convolver_state);
+            convolver_state.block_fill_position = 0;
+        }
+    }
+}
+
+// Function declaration for in-place execution of all enabled chain stages
+void run_audio_processing_chain(audio_processing_buffer& target_buffer, audio_processing_chain& processing_chain) {
+    // The system estimates and removes DC offset before any level-dependent stage
+    if (processing_chain.dc_blocking_stage_enabled) {
+        apply_dc_blocking_filter(target_buffer, processing_chain.dc_blocking_state);
+    }
+    
+    // The system shapes the spectrum before the dynamics stage measures its level
+    if (processing_chain.equalizer_stage_enabled) {
+        apply_parametric_equalizer(target_buffer, processing_chain.equalizer_state);
+    }
+    
+    // The system applies long impulse responses after tonal correction
+    if (processing_chain.convolution_stage_enabled) {
+        apply_partitioned_convolver(target_buffer, processing_chain.convolution_state);
+    }
+    
+    // The system applies the dynamics stage when enabled
+    if (processing_chain.dynamics_stage_enabled) {
+        apply_dynamics_processor(target_buffer, processing_chain.dynamics_configuration,
+                                 processing_chain.dynamics_state);
+    }
+}
+
+// Function declaration for media file initialization and setup
+media_file_metadata initialize_media_resource(const string& resource_name, 
+                                             const string& format_type, 
+                                             double duration_value, 
+                                             int bitrate_value) {
+    media_file_metadata media_resource;        // Local metadata structure instance
+    
+    // The system assigns the provided resource identifier to the media structure
+    media_resource.file_identifier = resource_name;
+    
+    // The system configures the format specification parameter
+    media_resource.format_specification = format_type;
+    
+    // The system establishes the duration parameter for playback calculations
+    media_resource.duration_seconds = duration_value;
+    
+    // The system configures the bit rate parameter for quality assessment
+    media_resource.bit_rate_kbps = bitrate_value;
+    
+    // The system determines codec compatibility based on format analysis
+    media_resource.codec_support_status = (format_type == "MP3" || format_type == "WAV" || format_type == "FLAC");
+    
+    return media_resource;                     // Function returns configured metadata structure
+}
+
+// Function declaration for audio buffer processing and analysis operations
+audio_processing_buffer process_audio_buffer(int buffer_size_parameter,
+                                             audio_processing_chain* processing_chain = nullptr) {
+    audio_processing_buffer processing_buffer; // Local buffer structure initialization
+    
+    // The system allocates storage for the specified buffer capacity
+    processing_buffer.sample_data_array.resize(buffer_size_parameter);
+    processing_buffer.channel_count = 1;
+    
+    // The system generates straight into the buffer and measures once after the block stages when a chain is set
+    if (processing_chain) {
+        gain_stage unity_stage;
+        generate_through_fused_chain(modulated_sine_generator{buffer_size_parameter}, unity_stage,
+                                     processing_buffer.sample_data_array.data(), buffer_size_parameter);
+        run_audio_processing_chain(processing_buffer, *processing_chain);
+        measure_audio_buffer_levels(processing_buffer);
+        return processing_buffer;
+    }
+    
+    // The system composes generation with peak, RMS and DC measurement into a single fused loop
+    peak_statistic_stage peak_statistic;
+    rms_statistic_stage rms_statistic;
+    mean_statistic_stage mean_statistic;
+    peak_statistic.peak_target = &processing_buffer.peak_amplitude_level;
+    rms_statistic.rms_target = &processing_buffer.rms_power_level;
+    mean_statistic.mean_target = &processing_buffer.dc_offset_level;
+    auto measurement_chain = peak_statistic | rms_statistic | mean_statistic;
+    generate_through_fused_chain(modulated_sine_generator{buffer_size_parameter}, measurement_chain,
+                                 processing_buffer.sample_data_array.data(), buffer_size_parameter);
+    
+    // The system records the total number of processed samples
+    processing_buffer.processed_sample_count = buffer_size_parameter;
+    
+    return processing_buffer;                  // Function returns populated buffer structure
+}
+
+// Function declaration for codec processing simulation with timing analysis
+double simulate_codec_processing(const media_file_metadata& media_data, 
+                                int processing_cycle_number) {
+    // The system initiates high-resolution timing measurement
+    auto start_timestamp = chrono::high_resolution_clock::now();
+    
+    // The system simulates codec processing delay for realistic operation timing
+    this_thread::sleep_for(chrono::milliseconds(CODEC_PROCESSING_DELAY));
+    
+    // The system performs computational operations to simulate codec workload
+    double processing_efficiency = 0.0;
+    for (int computation_index = 0; computation_index < 1000; computation_index++) {
+        // The system executes mathematical operations representative of codec processing
+        processing_efficiency += sin(computation_index * 0.01) * cos(processing_cycle_number * 0.02);
+    }
+    
+    // The system calculates processing efficiency based on media characteristics
+    processing_efficiency = abs(processing_efficiency) / (media_data.bit_rate_kbps * 0.001);
+    
+    // The system records completion timestamp for performance analysis
+    auto end_timestamp = chrono::high_resolution_clock::now();
+    
+    // The system calculates total processing duration in milliseconds
+    auto processing_duration = chrono::duration_cast<chrono::milliseconds>(end_timestamp - start_timestamp);
+    
+    return processing_duration.count();       // Function returns processing time in milliseconds
+}
+
+// Function declaration for visual progress indicator generation
+void display_progress_visualization(int current_cycle, int total_cycles, 
+                                  double processing_time_ms, double efficiency_rating) {
+    // The system calculates completion percentage for progress tracking
+    double completion_percentage = (double(current_cycle) / total_cycles) * 100.0;
+    
+    // The system determines progress bar length based on completion status
+    int progress_bar_length = int(completion_percentage / 5.0);  // Scale to 20-character bar
+    
+    // The system generates visual progress bar representation
+    cout << "\n[Processing Cycle " << setw(2) << current_cycle << "/" << total_cycles << "] ";
+    cout << "[";
+    
+    // The system renders filled progress indicators
+    for (int bar_position = 0; bar_position < 20; bar_position++) {
+        if (bar_position < progress_bar_length) {
+            cout << "█";                       // The system displays filled progress segments
+        } else {
+            cout << "░";                       // The system displays empty progress segments
+        }
+    }
+    
+    // The system displays completion percentage and performance metrics
+    cout << "] " << fixed << setprecision(1) << completion_percentage << "%";
+    cout << " | Processing Time: " << setprecision(2) << processing_time_ms << "ms";
+    cout << " | Efficiency: " << setprecision(3) << efficiency_rating;
+}
+
+// Function declaration for comprehensive statistical analysis and reporting
+void generate_performance_analytics(const vector<double>& processing_time_data, 
+                                   const vector<double>& efficiency_data,
+                                   const audio_processing_buffer& audio_analysis) {
+    // The system calculates aggregate processing time statistics
+    double total_processing_time = 0.0;
+    double minimum_processing_time = *min_element(processing_time_data.begin(), processing_time_data.end());
+    double maximum_processing_time = *max_element(processing_time_data.begin(), processing_time_data.end());
+    
+    // The system accumulates total processing time for average calculation
+    for (double time_value : processing_time_data) {
+        total_processing_time += time_value;
+    }
+    double average_processing_time = total_processing_time / processing_time_data.size();
+    
+    // The system calculates aggregate efficiency statistics
+    double total_efficiency = 0.0;
+    double minimum_efficiency = *min_element(efficiency_data.begin(), efficiency_data.end());
+    double maximum_efficiency = *max_element(efficiency_data.begin(), efficiency_data.end());
+    
+    // The system accumulates total efficiency for average calculation
+    for (double efficiency_value : efficiency_data) {
+        total_efficiency += efficiency_value;
+    }
+    double average_efficiency = total_efficiency / efficiency_data.size();
+    
+    // The system generates comprehensive performance report header
+    cout << "\n\n" << string(80, '=') << "\n";
+    cout << "              MEDIA PLAYER PERFORMANCE ANALYSIS REPORT\n";
+    cout << string(80, '=') << "\n";
+    
+    // The system displays codec processing performance metrics
+    cout << "\nCODEC PROCESSING PERFORMANCE METRICS:\n";
+    cout << string(50, '-') << "\n";
+    cout << "Total Processing Cycles Completed: " << processing_time_data.size() << "\n";
+    cout << "Average Processing Time per Cycle: " << fixed << setprecision(2) 
+         << average_processing_time << " milliseconds\n";
+    cout << "Minimum Processing Time Recorded: " << minimum_processing_time << " milliseconds\n";
+    cout << "Maximum Processing Time Recorded: " << maximum_processing_time << " milliseconds\n";
+    cout << "Total Cumulative Processing Time: " << total_processing_time << " milliseconds\n";
+    
+    // The system displays efficiency analysis results
+    cout << "\nPROCESSING EFFICIENCY ANALYSIS:\n";
+    cout << string(50, '-') << "\n";
+    cout << "Average Processing Efficiency: " << fixed << setprecision(4) << average_efficiency << "\n";
+    cout << "Peak Efficiency Achievement: " << maximum_efficiency << "\n";
+    cout << "Minimum Efficiency Recorded: " << minimum_efficiency << "\n";
+    
+    // The system displays audio processing analysis results
+    cout << "\nAUDIO BUFFER ANALYSIS RESULTS:\n";
+    cout << string(50, '-') << "\n";
+    cout << "Total Audio Samples Processed: " << audio_analysis.processed_sample_count << "\n";
+    cout << "Peak Amplitude Level Detected: " << fixed << setprecision(4) 
+         << audio_analysis.peak_amplitude_level << "\n";
+    cout << "RMS Power Level Calculated: " << audio_analysis.rms_power_level << "\n";
+    cout << "Dynamic Range Analysis: " << (audio_analysis.peak_amplitude_level / audio_analysis.rms_power_level) << "\n";
+    
+    // The system separates the DC component from the AC signal power it would otherwise inflate
+    double ac_rms_level = sqrt(max(0.0, audio_analysis.rms_power_level * audio_analysis.rms_power_level -
+                                        audio_analysis.dc_offset_level * audio_analysis.dc_offset_level));
+    cout << "DC Offset Level Detected (Unprocessed): " << setprecision(6) << audio_analysis.dc_offset_level << "\n";
+    cout << "DC-Corrected RMS Level: " << setprecision(4) << ac_rms_level << "\n";
+    cout << "DC-Corrected Dynamic Range: "
+         << (ac_rms_level > 0.0 ? audio_analysis.peak_amplitude_level / ac_rms_level : 0.0) << "\n";
+    
+    // The system provides professional interpretation of results
+    cout << "\nPROFESSIONAL ANALYSIS INTERPRETATION:\n";
+    cout << string(50, '-') << "\n";
+    if (average_processing_time < 150.0) {
+        cout << "✓ Processing performance demonstrates optimal codec efficiency\n";
+    } else {
+        cout << "⚠ Processing performance indicates potential optimization opportunities\n";
+    }
+    
+    if (audio_analysis.peak_amplitude_level > 0.8) {
+        cout << "✓ Audio signal demonstrates sufficient amplitude for quality playback\n";
+    } else {
+        cout << "⚠ Audio signal may require amplitude normalization processing\n";
+    }
+    
+    cout << "\n" << string(80, '=') << "\n";
+}
+
+// Enumeration of reconstruction methods available for clipped regions
+enum declipping_interpolation_mode {
+    DECLIP_DETECT_ONLY,                       // Report clip events without modifying samples
+    DECLIP_CUBIC,                             // Cubic polynomial through neighbouring clean samples
+    DECLIP_AUTOREGRESSIVE                     // Linear prediction from both sides of the region
+};
+
+// Structure definition for clipping detector parameter configuration
+struct clipping_detector_configuration {
+    double clip_threshold_level;              // Absolute level treated as full scale
+    int minimum_run_length;                   // Consecutive full-scale samples forming a clip event
+    declipping_interpolation_mode reconstruction_mode; // Selected reconstruction method
+    int autoregressive_order;                 // Prediction order for autoregressive reconstruction
+    int autoregressive_context;               // Clean samples used to fit each prediction model
+};
+
+// Structure definition for a single detected clip event
+struct clip_event_record {
+    int channel_index;                        // Channel plane containing the event
+    int start_frame;                          // First clipped frame of the event
+    int duration_frames;                      // Number of consecutive clipped frames
+};
+
+// Structure definition for clipping analysis results
+struct clipping_analysis_report {
+    vector<clip_event_record> clip_events;    // Detected clip events in channel and time order
+    long long full_scale_sample_count;        // Samples at or above the clip threshold
+    int longest_event_frames;                 // Duration of the longest detected event
+    int reconstructed_event_count;            // Events rewritten by the declipper
+};
+
+// Function declaration for vectorized full-scale sample counting
+int count_full_scale_samples(const double* channel_plane, int frame_count, double clip_threshold_level) {
+    // The system accumulates comparison results without branching so the loop vectorizes
+    int full_scale_total = 0;
+    for (int frame_index = 0; frame_index < frame_count; frame_index++) {
+        full_scale_total += (abs(channel_plane[frame_index]) >= clip_threshold_level) ? 1 : 0;
+    }
+    return full_scale_total;                   // Function returns number of full-scale samples
+}
+
+// Function declaration for clip event detection across all channel planes
+clipping_analysis_report detect_clipping_events(const audio_processing_buffer& audio_buffer,
+                                                const clipping_detector_configuration& configuration) {
+    clipping_analysis_report analysis_report;  // Local report structure instance
+    analysis_report.full_scale_sample_count = 0;
+    analysis_report.longest_event_frames = 0;
+    analysis_report.reconstructed_event_count = 0;
+
+    int frame_total = frames_per_channel(audio_buffer);
+    int minimum_run = max(1, configuration.minimum_run_length);
+
+    // Iterative loop examines each channel plane independently
+    for (int channel_index = 0; channel_index < audio_buffer.channel_count; channel_index++) {
+        const double* channel_plane = access_channel_plane(audio_buffer, channel_index);
+        int run_start = -1;
+
+        // The system walks sub-blocks and only inspects individual samples when the block count is non-zero
+        for (int block_start = 0; block_start < frame_total; block_start += PROCESSING_SUB_BLOCK_SIZE) {
+            int block_length = min(PROCESSING_SUB_BLOCK_SIZE, frame_total - block_start);
+            int block_full_scale = count_full_scale_samples(channel_plane + block_start, block_length,
+                                                            configuration.clip_threshold_level);
+            analysis_report.full_scale_sample_count += block_full_scale;
+
+            // The system closes any open run and skips clean blocks without per-sample work
+            if (block_full_scale == 0) {
+                if (run_start >= 0 && block_start - run_start >= minimum_run) {
+                    analysis_report.clip_events.push_back({channel_index, run_start, block_start - run_start});
+                }
+                run_start = -1;
+                continue;
+            }
+
+            // The system traces run boundaries inside blocks that contain full-scale samples
+            for (int frame_index = block_start; frame_index < block_start + block_length; frame_index++) {
+                bool full_scale = abs(channel_plane[frame_index]) >= configuration.clip_threshold_level;
+                if (full_scale && run_start < 0) {
+                    run_start = frame_index;
+                } else if (!full_scale && run_start >= 0) {
+                    if (frame_index - run_start >= minimum_run) {
+                        analysis_report.clip_events.push_back({channel_index, run_start, frame_index - run_start});
+                    }
+                    run_start = -1;
+                }
+            }
+        }
+
+        // The system records a run that extends to the end of the buffer
+        if (run_start >= 0 && frame_total - run_start >= minimum_run) {
+            analysis_report.clip_events.push_back({channel_index, run_start, frame_total - run_start});
+        }
+    }
+
+    // The system determines the longest event duration for reporting
+    for (const clip_event_record& clip_event : analysis_report.clip_events) {
+        analysis_report.longest_event_frames = max(analysis_report.longest_event_frames, clip_event.duration_frames);
+    }
+
+    return analysis_report;                    // Function returns populated clipping report
+}
+
+// Function declaration for autoregressive model estimation using Burg's method
+vector<double> estimate_autoregressive_coefficients(const double* context_samples, int context_length,
+                                                    int model_order) {
+    // The system initializes forward and backward prediction error sequences from the context
+    vector<double> forward_error(context_samples, context_samples + context_length);
+    vector<double> backward_error(context_samples, context_samples + context_length);
+    vector<double> error_filter(model_order + 1, 0.0);
+    error_filter[0] = 1.0;
+
+    // Iterative loop raises the model order one reflection coefficient at a time
+    for (int order_index = 0; order_index < model_order; order_index++) {
+        double cross_energy = 0.0;
+        double total_energy = 1e-18;
+        for (int sample_index = order_index + 1; sample_index < context_length; sample_index++) {
+            cross_energy += forward_error[sample_index] * backward_error[sample_index - 1];
+            total_energy += forward_error[sample_index] * forward_error[sample_index] +
+                            backward_error[sample_index - 1] * backward_error[sample_index - 1];
+        }
+        double reflection_coefficient = -2.0 * cross_energy / total_energy;
+
+        // The system updates the prediction error filter with its mirrored taps
+        for (int tap_index = 0; tap_index <= (order_index + 1) / 2; tap_index++) {
+            double leading_tap = error_filter[tap_index];
+            double trailing_tap = error_filter[order_index + 1 - tap_index];
+            error_filter[tap_index] = leading_tap + reflection_coefficient * trailing_tap;
+            if (tap_index != order_index + 1 - tap_index) {
+                error_filter[order_index + 1 - tap_index] = trailing_tap + reflection_coefficient * leading_tap;
+            }
+        }
+
+        // The system propagates forward and backward errors to the next order
+        for (int sample_index = context_length - 1; sample_index > order_index; sample_index--) {
+            double forward_value = forward_error[sample_index];
+            forward_error[sample_index] = forward_value + reflection_coefficient * backward_error[sample_index - 1];
+            backward_error[sample_index] = backward_error[sample_index - 1] + reflection_coefficient * forward_value;
+        }
+    }
+
+    // The system converts the error filter into direct prediction coefficients
+    vector<double> prediction_coefficients(model_order);
+    for (int tap_index = 0; tap_index < model_order; tap_index++) {
+        prediction_coefficients[tap_index] = -error_filter[tap_index + 1];
+    }
+    return prediction_coefficients;            // Function returns prediction coefficients (lag 1 first)
+}
+
+// Function declaration for autoregressive extrapolation of a gap from one side
+void extrapolate_autoregressive_gap(const vector<double>& prediction_coefficients,
+                                    vector<double>& history_and_gap, int history_length) {
+    // The system predicts each gap sample from the preceding model-order samples
+    int model_order = int(prediction_coefficients.size());
+    for (size_t gap_index = history_length; gap_index < history_and_gap.size(); gap_index++) {
+        double predicted_value = 0.0;
+        for (int tap_index = 0; tap_index < model_order && tap_index < int(gap_index); tap_index++) {
+            predicted_value += prediction_coefficients[tap_index] * history_and_gap[gap_index - 1 - tap_index];
+        }
+        history_and_gap[gap_index] = predicted_value;
+    }
+}
+
+// Function declaration for in-place reconstruction of detected clip events
+void reconstruct_clipped_regions(audio_processing_buffer& audio_buffer,
+                                 clipping_analysis_report& analysis_report,
+                                 const clipping_detector_configuration& configuration) {
+    // The system leaves the buffer untouched when only detection was requested
+    if (configuration.reconstruction_mode == DECLIP_DETECT_ONLY) {
+        return;
+    }
+
+    int frame_total = frames_per_channel(audio_buffer);
+
+    // Iterative loop rewrites only the flagged regions
+    for (size_t event_index = 0; event_index < analysis_report.clip_events.size(); event_index++) {
+        const clip_event_record& clip_event = analysis_report.clip_events[event_index];
+        double* channel_plane = access_channel_plane(audio_buffer, clip_event.channel_index);
+        int region_start = clip_event.start_frame;
+        int region_end = clip_event.start_frame + clip_event.duration_frames;
+
+        // The system bounds the clean context by the neighbouring events on the same channel
+        int clean_context_start = 0;
+        int clean_context_end = frame_total;
+        if (event_index > 0 && analysis_report.clip_events[event_index - 1].channel_index == clip_event.channel_index) {
+            const clip_event_record& previous_event = analysis_report.clip_events[event_index - 1];
+            clean_context_start = previous_event.start_frame + previous_event.duration_frames;
+        }
+        if (event_index + 1 < analysis_report.clip_events.size() &&
+            analysis_report.clip_events[event_index + 1].channel_index == clip_event.channel_index) {
+            clean_context_end = analysis_report.clip_events[event_index + 1].start_frame;
+        }
+
+        // The system requires clean samples on both sides of the region for interpolation
+        if (region_start < 2 || region_end + 2 > frame_total) {
+            continue;
+        }
+
+        vector<double> reconstructed_region(clip_event.duration_frames, 0.0);
+
+        if (configuration.reconstruction_mode == DECLIP_CUBIC) {
+            // The system fits a cubic through two clean samples on each side using Lagrange form
+            double anchor_positions[4] = {double(region_start - 2), double(region_start - 1),
+                                          double(region_end), double(region_end + 1)};
+            double anchor_values[4] = {channel_plane[region_start - 2], channel_plane[region_start - 1],
+                                       channel_plane[region_end], channel_plane[region_end + 1]};
+            for (int gap_index = 0; gap_index < clip_event.duration_frames; gap_index++) {
+                double position = double(region_start + gap_index);
+                double interpolated_value = 0.0;
+                for (int anchor_index = 0; anchor_index < 4; anchor_index++) {
+                    double basis_weight = 1.0;
+                    for (int other_index = 0; other_index < 4; other_index++) {
+                        if (other_index != anchor_index) {
+                            basis_weight *= (position - anchor_positions[other_index]) /
+                                            (anchor_positions[anchor_index] - anchor_positions[other_index]);
+                        }
+                    }
+                    interpolated_value += basis_weight * anchor_values[anchor_index];
+                }
+                reconstructed_region[gap_index] = interpolated_value;
+            }
+        } else {
+            // The system fits forward and backward prediction models on the clean context
+            int forward_context = min(configuration.autoregressive_context, region_start - clean_context_start);
+            int backward_context = min(configuration.autoregressive_context, clean_context_end - region_end);
+            int model_order = max(1, min(configuration.autoregressive_order, min(forward_context, backward_context) / 2));
+
+            vector<double> forward_series(channel_plane + region_start - forward_context, channel_plane + region_start);
+            vector<double> forward_coefficients = estimate_autoregressive_coefficients(
+                forward_series.data(), forward_context, model_order);
+            forward_series.resize(forward_context + clip_event.duration_frames);
+            extrapolate_autoregressive_gap(forward_coefficients, forward_series, forward_context);
+
+            vector<double> backward_series(backward_context);
+            for (int context_index = 0; context_index < backward_context; context_index++) {
+                backward_series[context_index] = channel_plane[region_end + backward_context - 1 - context_index];
+            }
+            vector<double> backward_coefficients = estimate_autoregressive_coefficients(
+                backward_series.data(), backward_context, model_order);
+            backward_series.resize(backward_context + clip_event.duration_frames);
+            extrapolate_autoregressive_gap(backward_coefficients, backward_series, backward_context);
+
+            // The system cross-fades both predictions across the region
+            for (int gap_index = 0; gap_index < clip_event.duration_frames; gap_index++) {
+                double fade_position = (gap_index + 1.0) / (clip_event.duration_frames + 1.0);
+                double forward_value = forward_series[forward_context + gap_index];
+                double backward_value = backward_series[backward_context + clip_event.duration_frames - 1 - gap_index];
+                reconstructed_region[gap_index] = (1.0 - fade_position) * forward_value + fade_position * backward_value;
+            }
+        }
+
+        // The system keeps reconstructed samples at or beyond the clip level with the original polarity
+        for (int gap_index = 0; gap_index < clip_event.duration_frames; gap_index++) {
+            double original_sample = channel_plane[region_start + gap_index];
+            double polarity = original_sample < 0.0 ? -1.0 : 1.0;
+            channel_plane[region_start + gap_index] = polarity * max(abs(reconstructed_region[gap_index]),
+                                                                     abs(original_sample));
+        }
+        analysis_report.reconstructed_event_count++;
+    }
+}
+
+// Function declaration for clipping analysis result reporting
+void display_clipping_analysis(const string& buffer_label, const clipping_analysis_report& analysis_report) {
+    // The system summarises clip events with durations expressed in milliseconds
+    cout << buffer_label << ": " << analysis_report.clip_events.size() << " clip events | "
+         << analysis_report.full_scale_sample_count << " full-scale samples | Longest Event: "
+         << fixed << setprecision(3) << (analysis_report.longest_event_frames * 1000.0 / SAMPLE_RATE) << " ms";
+    if (analysis_report.reconstructed_event_count > 0) {
+        cout << " | Reconstructed: " << analysis_report.reconstructed_event_count;
+    }
+    cout << "\n";
+
+    // The system lists the first few events individually
+    size_t listed_events = min<size_t>(analysis_report.clip_events.size(), 3);
+    for (size_t event_index = 0; event_index < listed_events; event_index++) {
+        const clip_event_record& clip_event = analysis_report.clip_events[event_index];
+        cout << "  Event " << event_index + 1 << ": channel " << clip_event.channel_index
+             << " at frame " << clip_event.start_frame << " for " << clip_event.duration_frames << " frames ("
+             << setprecision(3) << (clip_event.duration_frames * 1000.0 / SAMPLE_RATE) << " ms)\n";
+    }
+}
+
+// Structure definition for silence detector parameter configuration
+struct silence_detector_configuration {
+    double threshold_db;                      // Level below which audio counts as silence in dBFS
+    double minimum_silence_ms;                // Shortest quiet span reported as a silence range
+};
+
+// Structure definition for a contiguous silent span of frames
+struct silence_range_record {
+    long long start_frame;                    // First silent frame of the range
+    long long end_frame;                      // Frame following the last silent frame
+};
+
+// Structure definition for streaming silence detector state
+struct silence_detector_state {
+    double threshold_level;                   // Linear amplitude threshold derived from configuration
+    long long minimum_silence_frames;         // Minimum range length in frames
+    long long processed_frame_count;          // Frames consumed so far across all blocks
+    long long open_silence_start;             // Start of the current quiet span or -1 while audible
+    long long first_audible_frame;            // First frame at or above threshold or -1 if none
+    long long last_audible_end;               // Frame following the most recent audible frame
+    long long rejected_block_count;           // Blocks rejected by the peak test alone
+    long long inspected_block_count;          // Blocks requiring per-frame inspection
+    vector<silence_range_record> silence_ranges; // Completed quiet spans meeting minimum length
+};
+
+// Structure definition for final silence analysis and trim results
+struct silence_analysis_report {
+    long long total_frame_count;              // Frames analysed in the stream
+    long long trim_start_frame;               // First frame to keep after leading trim
+    long long trim_end_frame;                 // Frame following the last frame to keep
+    long long leading_silence_frames;         // Length of leading silence
+    long long trailing_silence_frames;        // Length of trailing silence
+    vector<silence_range_record> internal_silence_ranges; // Quiet spans between audible material
+    long long rejected_block_count;           // Blocks rejected by the peak test alone
+    long long inspected_block_count;          // Blocks requiring per-frame inspection
+    bool scan_succeeded;                      // Whether the stream could be opened and its layout was valid
+};
+
+// Function declaration for vectorized absolute peak reduction over contiguous samples
+double compute_block_peak_level(const double* sample_data, int sample_count) {
+    // The system keeps independent lane maxima so the reduction maps onto SIMD registers
+    double lane_maximum[SIMD_LANE_COUNT] = {0.0};
+    int vector_length = sample_count - sample_count % SIMD_LANE_COUNT;
+    for (int sample_index = 0; sample_index < vector_length; sample_index += SIMD_LANE_COUNT) {
+        for (int lane_index = 0; lane_index < SIMD_LANE_COUNT; lane_index++) {
+            double magnitude = abs(sample_data[sample_index + lane_index]);
+            lane_maximum[lane_index] = magnitude > lane_maximum[lane_index] ? magnitude : lane_maximum[lane_index];
+        }
+    }
+
+    // The system folds the remaining tail samples and lane maxima into one value
+    for (int sample_index = vector_length; sample_index < sample_count; sample_index++) {
+        lane_maximum[0] = max(lane_maximum[0], abs(sample_data[sample_index]));
+    }
+    double block_peak = 0.0;
+    for (int lane_index = 0; lane_index < SIMD_LANE_COUNT; lane_index++) {
+        block_peak = max(block_peak, lane_maximum[lane_index]);
+    }
+    return block_peak;                         // Function returns absolute peak of the samples
+}
+
+// Function declaration for analysis sidecar and scratch file location
+string analysis_storage_path(const string& file_name) {
+    // The system places generated analysis files in the platform temporary directory
+    return (filesystem::temp_directory_path() / file_name).string();
+}
+
+// Function declaration for streaming silence detector initialization
+silence_detector_state initialize_silence_detector(const silence_detector_configuration& configuration) {
+    silence_detector_state detector_state;     // Local state structure instance
+
+    // The system converts the configured thresholds into linear and frame units
+    detector_state.threshold_level = pow(10.0, configuration.threshold_db / 20.0);
+    detector_state.minimum_silence_frames = max(1LL, (long long)(configuration.minimum_silence_ms * SAMPLE_RATE / 1000.0));
+    detector_state.processed_frame_count = 0;
+    detector_state.open_silence_start = 0;
+    detector_state.first_audible_frame = -1;
+    detector_state.last_audible_end = 0;
+    detector_state.rejected_block_count = 0;
+    detector_state.inspected_block_count = 0;
+
+    return detector_state;                     // Function returns prepared detector state
+}
+
+// Function declaration for closing a quiet span when audible material resumes
+void close_silence_span(silence_detector_state& detector_state, long long audible_frame) {
+    // The system records the span when it satisfies the minimum duration
+    if (detector_state.open_silence_start >= 0 &&
+        audible_frame - detector_state.open_silence_start >= detector_state.minimum_silence_frames) {
+        detector_state.silence_ranges.push_back({detector_state.open_silence_start, audible_frame});
+    }
+    detector_state.open_silence_start = -1;
+}
+
+// Function declaration for streaming silence detection over one planar buffer
+void feed_silence_detector(silence_detector_state& detector_state, const audio_processing_buffer& audio_buffer) {
+    int frame_total = frames_per_channel(audio_buffer);
+
+    // Iterative loop evaluates the buffer in analysis blocks of the standard buffer size
+    for (int block_start = 0; block_start < frame_total; block_start += AUDIO_BUFFER_SIZE) {
+        int block_length = min(AUDIO_BUFFER_SIZE, frame_total - block_start);
+        long long block_origin = detector_state.processed_frame_count + block_start;
+
+        // The system rejects quiet blocks with a single peak reduction per channel plane
+        double block_peak = 0.0;
+        for (int channel_index = 0; channel_index < audio_buffer.channel_count; channel_index++) {
+            block_peak = max(block_peak, compute_block_peak_level(
+                access_channel_plane(audio_buffer, channel_index) + block_start, block_length));
+        }
+        if (block_peak < detector_state.threshold_level) {
+            if (detector_state.open_silence_start < 0) {
+                detector_state.open_silence_start = block_origin;
+            }
+            detector_state.rejected_block_count++;
+            continue;
+        }
+
+        // The system locates audible frames individually only inside blocks that exceed the threshold
+        detector_state.inspected_block_count++;
+        for (int frame_index = 0; frame_index < block_length; frame_index++) {
+            bool audible_frame = false;
+            for (int channel_index = 0; channel_index < audio_buffer.channel_count; channel_index++) {
+                audible_frame |= abs(access_channel_plane(audio_buffer, channel_index)[block_start + frame_index]) >=
+                                 detector_state.threshold_level;
+            }
+            long long absolute_frame = block_origin + frame_index;
+            if (audible_frame) {
+                close_silence_span(detector_state, absolute_frame);
+                if (detector_state.first_audible_frame < 0) {
+                    detector_state.first_audible_frame = absolute_frame;
+                }
+                detector_state.last_audible_end = absolute_frame + 1;
+            } else if (detector_state.open_silence_start < 0) {
+                detector_state.open_silence_start = absolute_frame;
+            }
+        }
+    }
+
+    // The system advances the stream position past the consumed buffer
+    detector_state.processed_frame_count += frame_total;
+}
+
+// Function declaration for silence detection finalization and trim point derivation
+silence_analysis_report finalize_silence_detection(silence_detector_state& detector_state) {
+    silence_analysis_report analysis_report;   // Local report structure instance
+
+    // The system closes any span still open at the end of the stream
+    close_silence_span(detector_state, detector_state.processed_frame_count);
+
+    // The system derives trim points, treating an entirely silent stream as zero-length content
+    analysis_report.total_frame_count = detector_state.processed_frame_count;
+    analysis_report.trim_start_frame = detector_state.first_audible_frame >= 0 ?
+                                       detector_state.first_audible_frame : detector_state.processed_frame_count;
+    analysis_report.trim_end_frame = max(analysis_report.trim_start_frame, detector_state.last_audible_end);
+    analysis_report.leading_silence_frames = analysis_report.trim_start_frame;
+    analysis_report.trailing_silence_frames = analysis_report.total_frame_count - analysis_report.trim_end_frame;
+    analysis_report.rejected_block_count = detector_state.rejected_block_count;
+    analysis_report.inspected_block_count = detector_state.inspected_block_count;
+    analysis_report.scan_succeeded = true;
+
+    // The system keeps only ranges lying strictly between audible material as internal silence
+    for (const silence_range_record& silence_range : detector_state.silence_ranges) {
+        if (silence_range.start_frame > analysis_report.trim_start_frame &&
+            silence_range.end_frame < analysis_report.trim_end_frame) {
+            analysis_report.internal_silence_ranges.push_back(silence_range);
+        }
+    }
+
+    return analysis_report;                    // Function returns completed silence report
+}
+
+// Function declaration for streaming silence detection over an interleaved float32 PCM file
+silence_analysis_report scan_pcm_file_for_silence(const string& file_path, int channel_count,
+                                                  const silence_detector_configuration& configuration) {
+    silence_detector_state detector_state = initialize_silence_detector(configuration);
+
+    // The system reports a failed scan rather than an empty success for unusable inputs
+    ifstream pcm_stream(file_path, ios::binary);
+    if (channel_count <= 0 || !pcm_stream) {
+        silence_analysis_report failed_report = finalize_silence_detection(detector_state);
+        failed_report.scan_succeeded = false;
+        return failed_report;
+    }
+
+    // The system reads large contiguous chunks into reused storage to sustain sequential disk throughput
+    const int chunk_frames = AUDIO_BUFFER_SIZE * 64;
+    vector<float> interleaved_chunk(size_t(chunk_frames) * channel_count);
+    audio_processing_buffer planar_chunk;
+    planar_chunk.channel_count = channel_count;
+    planar_chunk.sample_data_array.reserve(size_t(chunk_frames) * channel_count);
+
+    while (pcm_stream) {
+        pcm_stream.read(reinterpret_cast<char*>(interleaved_chunk.data()),
+                        streamsize(interleaved_chunk.size() * sizeof(float)));
+        int frames_read = int(pcm_stream.gcount() / streamsize(sizeof(float) * channel_count));
+        if (frames_read == 0) {
+            break;
+        }
+
+        // The system deinterleaves the chunk into planar layout for the detector
+        planar_chunk.sample_data_array.resize(size_t(frames_read) * channel_count);
+        for (int channel_index = 0; channel_index < channel_count; channel_index++) {
+            double* channel_plane = access_channel_plane(planar_chunk, channel_index);
+            for (int frame_index = 0; frame_index < frames_read; frame_index++) {
+                channel_plane[frame_index] = interleaved_chunk[size_t(frame_index) * channel_count + channel_index];
+            }
+        }
+        feed_silence_detector(detector_state, planar_chunk);
+    }
+
+    return finalize_silence_detection(detector_state); // Function returns file-level silence report
+}
+
+// Function declaration for silence analysis result reporting
+void display_silence_analysis(const silence_analysis_report& analysis_report) {
+    if (!analysis_report.scan_succeeded) {
+        cout << "Silence Scan: failed (stream missing or invalid channel count)\n";
+        return;
+    }
+
+    // The system reports trim points and silence durations in seconds
+    cout << "Analysed Duration: " << fixed << setprecision(3)
+         << analysis_report.total_frame_count / SAMPLE_RATE << " seconds\n";
+    cout << "Trim Points: " << analysis_report.trim_start_frame / SAMPLE_RATE << " s to "
+         << analysis_report.trim_end_frame / SAMPLE_RATE << " s"
+         << " | Leading: " << analysis_report.leading_silence_frames / SAMPLE_RATE << " s"
+         << " | Trailing: " << analysis_report.trailing_silence_frames / SAMPLE_RATE << " s\n";
+    for (const silence_range_record& silence_range : analysis_report.internal_silence_ranges) {
+        cout << "Internal Silence: " << silence_range.start_frame / SAMPLE_RATE << " s to "
+             << silence_range.end_frame / SAMPLE_RATE << " s\n";
+    }
+    cout << "Blocks Rejected by Peak Test: " << analysis_report.rejected_block_count
+         << " | Blocks Inspected: " << analysis_report.inspected_block_count << "\n";
+}
+
+// Resolution of the goniometer histogram along each display axis
+const int GONIOMETER_RESOLUTION = 32;
+
+// Structure definition for per-block stereo image measurements
+struct stereo_block_metrics {
+    double phase_correlation;                 // Normalised left/right correlation in [-1, 1]
+    double balance_position;                  // Energy balance from -1 (left) to +1 (right)
+    double mid_side_ratio_db;                 // Mid energy relative to side energy in decibels
+};
+
+// Structure definition for stereo image accumulation across a stream
+struct stereo_image_accumulator {
+    double left_energy;                       // Sum of squared left samples
+    double right_energy;                      // Sum of squared right samples
+    double cross_energy;                      // Sum of left and right sample products
+    long long analysed_frame_count;           // Frames accumulated so far
+    vector<long long> goniometer_histogram;   // Mid/side occupancy counts (row = mid, column = side)
+};
+
+// Function declaration for stereo image accumulator initialization
+stereo_image_accumulator initialize_stereo_image_accumulator() {
+    stereo_image_accumulator image_accumulator; // Local accumulator structure instance
+
+    // The system clears energy sums and allocates the histogram once up front
+    image_accumulator.left_energy = 0.0;
+    image_accumulator.right_energy = 0.0;
+    image_accumulator.cross_energy = 0.0;
+    image_accumulator.analysed_frame_count = 0;
+    image_accumulator.goniometer_histogram.assign(GONIOMETER_RESOLUTION * GONIOMETER_RESOLUTION, 0);
+
+    return image_accumulator;                  // Function returns cleared accumulator
+}
+
+// Function declaration for stereo metric derivation from energy sums
+stereo_block_metrics derive_stereo_metrics(double left_energy, double right_energy, double cross_energy) {
+    stereo_block_metrics block_metrics;        // Local metrics structure instance
+
+    // The system derives mid and side energy from the same three sums without another pass
+    double mid_energy = 0.5 * (left_energy + right_energy + 2.0 * cross_energy);
+    double side_energy = 0.5 * (left_energy + right_energy - 2.0 * cross_energy);
+    double energy_product = sqrt(left_energy * right_energy);
+
+    block_metrics.phase_correlation = energy_product > 1e-20 ? cross_energy / energy_product : 1.0;
+    block_metrics.balance_position = (left_energy + right_energy) > 1e-20 ?
+        (right_energy - left_energy) / (left_energy + right_energy) : 0.0;
+    block_metrics.mid_side_ratio_db = 10.0 * log10((max(mid_energy, 0.0) + 1e-20) / (max(side_energy, 0.0) + 1e-20));
+
+    return block_metrics;                      // Function returns derived stereo metrics
+}
+
+// Function declaration for fused stereo correlation, balance, mid/side and goniometer analysis
+stereo_block_metrics analyze_stereo_block(stereo_image_accumulator& image_accumulator,
+                                          const audio_processing_buffer& audio_buffer,
+                                          int left_channel = 0, int right_channel = 1) {
+    // The system returns neutral metrics without touching the accumulator when no left plane exists
+    if (left_channel < 0 || left_channel >= audio_buffer.channel_count) {
+        return derive_stereo_metrics(0.0, 0.0, 0.0);
+    }
+
+    // The system treats a mono buffer or missing right plane as identical channels
+    if (right_channel < 0 || right_channel >= audio_buffer.channel_count) {
+        right_channel = left_channel;
+    }
+    const double* left_plane = access_channel_plane(audio_buffer, left_channel);
+    const double* right_plane = access_channel_plane(audio_buffer, right_channel);
+    int frame_total = frames_per_channel(audio_buffer);
+
+    // The system maps mid/side coordinates in [-1, 1] onto histogram cells
+    const double histogram_scale = 0.5 * GONIOMETER_RESOLUTION;
+    const double rotation_factor = sqrt(0.5);
+    double left_energy = 0.0;
+    double right_energy = 0.0;
+    double cross_energy = 0.0;
+
+    // Single loop reads each plane once for every measurement
+    for (int frame_index = 0; frame_index < frame_total; frame_index++) {
+        double left_sample = left_plane[frame_index];
+        double right_sample = right_plane[frame_index];
+
+        // The system accumulates the three energy sums all metrics derive from
+        left_energy += left_sample * left_sample;
+        right_energy += right_sample * right_sample;
+        cross_energy += left_sample * right_sample;
+
+        // The system rotates the sample pair by 45 degrees and bins it with clamped indices
+        double mid_coordinate = rotation_factor * (left_sample + right_sample);
+        double side_coordinate = rotation_factor * (left_sample - right_sample);
+        int row_index = min(GONIOMETER_RESOLUTION - 1, max(0, int((1.0 - mid_coordinate) * histogram_scale)));
+        int column_index = min(GONIOMETER_RESOLUTION - 1, max(0, int((side_coordinate + 1.0) * histogram_scale)));
+        image_accumulator.goniometer_histogram[row_index * GONIOMETER_RESOLUTION + column_index]++;
+    }
+
+    // The system folds the block sums into the stream totals
+    image_accumulator.left_energy += left_energy;
+    image_accumulator.right_energy += right_energy;
+    image_accumulator.cross_energy += cross_energy;
+    image_accumulator.analysed_frame_count += frame_total;
+
+    return derive_stereo_metrics(left_energy, right_energy, cross_energy); // Function returns block metrics
+}
+
+// Function declaration for stereo image and mono compatibility reporting
+void display_stereo_image_analysis(const stereo_image_accumulator& image_accumulator) {
+    stereo_block_metrics stream_metrics = derive_stereo_metrics(image_accumulator.left_energy,
+                                                                image_accumulator.right_energy,
+                                                                image_accumulator.cross_energy);
+
+    // The system counts occupied goniometer cells as a measure of stereo spread
+    long long occupied_cells = count_if(image_accumulator.goniometer_histogram.begin(),
+                                        image_accumulator.goniometer_histogram.end(),
+                                        [](long long cell_count) { return cell_count > 0; });
+
+    cout << "Frames Analysed: " << image_accumulator.analysed_frame_count << "\n";
+    cout << "Phase Correlation: " << fixed << setprecision(4) << stream_metrics.phase_correlation
+         << " | Balance: " << stream_metrics.balance_position
+         << " | Mid/Side Ratio: " << setprecision(2) << stream_metrics.mid_side_ratio_db << " dB\n";
+    cout << "Goniometer Occupancy: " << occupied_cells << " of "
+         << GONIOMETER_RESOLUTION * GONIOMETER_RESOLUTION << " cells\n";
+    if (stream_metrics.phase_correlation > 0.3) {
+        cout << "✓ Stereo image is mono compatible\n";
+    } else {
+        cout << "⚠ Stereo image risks cancellation when summed to mono\n";
+    }
+}
+
+// Number of prototype filter taps contributing to each polyphase output sample
+const int POLYPHASE_TAPS_PER_PHASE = 32;
+
+// Structure definition for a cached polyphase interpolation and decimation filter bank
+struct polyphase_filter_bank {
+    int interpolation_factor;                 // Upsampling factor L of the rational ratio
+    int decimation_factor;                    // Downsampling factor M of the rational ratio
+    int taps_per_phase;                       // Coefficients per polyphase branch
+    vector<double> phase_coefficients;        // Time-reversed branch coefficients (phase, tap)
+};
+
+// Structure definition for streaming polyphase resampler state
+struct polyphase_resampler_state {
+    const polyphase_filter_bank* filter_bank; // Shared filter bank for the conversion ratio
+    int channel_count;                        // Number of planar channels converted
+    int phase_position;                       // Current branch index within the upsampled grid
+    int input_cursor;                         // Next input index relative to the incoming block
+    vector<double> channel_history;           // Trailing input samples per channel for the next block
+    vector<double> working_samples;           // Scratch holding history followed by the new block
+};
+
+// Function declaration for Kaiser-windowed sinc polyphase filter bank design
+polyphase_filter_bank design_polyphase_filter_bank(int interpolation_factor, int decimation_factor) {
+    polyphase_filter_bank filter_bank;         // Local filter bank structure instance
+    filter_bank.interpolation_factor = interpolation_factor;
+    filter_bank.decimation_factor = decimation_factor;
+    filter_bank.taps_per_phase = POLYPHASE_TAPS_PER_PHASE;
+
+    // The system places the cutoff below the narrower of the two Nyquist limits at the upsampled rate
+    int prototype_length = interpolation_factor * POLYPHASE_TAPS_PER_PHASE;
+    double cutoff_frequency = 0.5 * 0.92 / max(interpolation_factor, decimation_factor);
+    const double kaiser_beta = 9.0;
+    double window_normalisation = modified_bessel_i0(kaiser_beta);
+    double prototype_centre = 0.5 * (prototype_length - 1);
+
+    // The system distributes prototype taps into time-reversed branches for contiguous inner products
+    filter_bank.phase_coefficients.assign(size_t(prototype_length), 0.0);
+    for (int tap_index = 0; tap_index < prototype_length; tap_index++) {
+        double offset = tap_index - prototype_centre;
+        double sinc_argument = 2.0 * cutoff_frequency * offset;
+        double sinc_value = abs(sinc_argument) < 1e-12 ? 1.0 : sin(M_PI * sinc_argument) / (M_PI * sinc_argument);
+        double window_position = offset / (0.5 * prototype_length);
+        double window_value = modified_bessel_i0(kaiser_beta * sqrt(max(0.0, 1.0 - window_position * window_position))) /
+                              window_normalisation;
+        int phase_index = tap_index % interpolation_factor;
+        int branch_tap = tap_index / interpolation_factor;
+        filter_bank.phase_coefficients[size_t(phase_index) * POLYPHASE_TAPS_PER_PHASE +
+                                       (POLYPHASE_TAPS_PER_PHASE - 1 - branch_tap)] =
+            2.0 * cutoff_frequency * interpolation_factor * sinc_value * window_value;
+    }
+
+    return filter_bank;                        // Function returns designed filter bank
+}
+
+// Function declaration for shared polyphase filter bank lookup with one-time design per ratio
+const polyphase_filter_bank& acquire_polyphase_filter_bank(int interpolation_factor, int decimation_factor) {
+    // The system designs each rational ratio once and shares it between all streams
+    static map<pair<int, int>, polyphase_filter_bank> filter_bank_cache;
+    static mutex filter_bank_mutex;
+    lock_guard<mutex> cache_lock(filter_bank_mutex);
+    pair<int, int> ratio_key(interpolation_factor, decimation_factor);
+    auto cached_bank = filter_bank_cache.find(ratio_key);
+    if (cached_bank == filter_bank_cache.end()) {
+        cached_bank = filter_bank_cache.emplace(ratio_key,
+            design_polyphase_filter_bank(interpolation_factor, decimation_factor)).first;
+    }
+    return cached_bank->second;                // Function returns the cached filter bank
+}
+
+// Function declaration for streaming resampler initialization from source and target rates
+polyphase_resampler_state initialize_polyphase_resampler(int source_rate_hz, int target_rate_hz, int channel_count) {
+    polyphase_resampler_state resampler_state; // Local state structure instance
+
+    // The system rejects non-positive rates, leaving a converter without a filter bank that emits nothing
+    if (source_rate_hz <= 0 || target_rate_hz <= 0 || channel_count <= 0) {
+        resampler_state.filter_bank = nullptr;
+        resampler_state.channel_count = max(channel_count, 0);
+        resampler_state.phase_position = 0;
+        resampler_state.input_cursor = 0;
+        return resampler_state;
+    }
+
+    // The system reduces the rate pair to its smallest rational ratio
+    int common_divisor = gcd(source_rate_hz, target_rate_hz);
+    resampler_state.filter_bank = &acquire_polyphase_filter_bank(target_rate_hz / common_divisor,
+                                                                 source_rate_hz / common_divisor);
+    resampler_state.channel_count = channel_count;
+    resampler_state.phase_position = 0;
+    resampler_state.input_cursor = 0;
+    resampler_state.channel_history.assign(size_t(channel_count) * (POLYPHASE_TAPS_PER_PHASE - 1), 0.0);
+
+    return resampler_state;                    // Function returns prepared resampler state
+}
+
+// Function declaration for multi-accumulator polyphase inner product
+double polyphase_inner_product(const double* branch_coefficients, const double* input_window) {
+    // The system splits the fixed-length dot product across SIMD lanes before the final fold
+    double lane_sum[SIMD_LANE_COUNT] = {0.0};
+    for (int tap_index = 0; tap_index < POLYPHASE_TAPS_PER_PHASE; tap_index += SIMD_LANE_COUNT) {
+        for (int lane_index = 0; lane_index < SIMD_LANE_COUNT; lane_index++) {
+            lane_sum[lane_index] += branch_coefficients[tap_index + lane_index] * input_window[tap_index + lane_index];
+        }
+    }
+    double total_sum = 0.0;
+    for (int lane_index = 0; lane_index < SIMD_LANE_COUNT; lane_index++) {
+        total_sum += lane_sum[lane_index];
+    }
+    return total_sum;                          // Function returns filtered output sample
+}
+
+// Function declaration for streaming rational-ratio resampling of one planar block
+void resample_audio_block(polyphase_resampler_state& resampler_state, const audio_processing_buffer& input_buffer,
+                          audio_processing_buffer& output_buffer) {
+    if (!resampler_state.filter_bank) {
+        output_buffer.channel_count = resampler_state.channel_count;
+        output_buffer.sample_data_array.clear();
+        return;
+    }
+    const polyphase_filter_bank& filter_bank = *resampler_state.filter_bank;
+    const int history_length = POLYPHASE_TAPS_PER_PHASE - 1;
+    int input_frames = frames_per_channel(input_buffer);
+
+    // The system predicts the output length by walking the shared phase schedule once
+    int output_frames = 0;
+    int schedule_phase = resampler_state.phase_position;
+    int schedule_cursor = resampler_state.input_cursor;
+    while (schedule_cursor < input_frames) {
+        output_frames++;
+        schedule_phase += filter_bank.decimation_factor;
+        schedule_cursor += schedule_phase / filter_bank.interpolation_factor;
+        schedule_phase %= filter_bank.interpolation_factor;
+    }
+    output_buffer.channel_count = resampler_state.channel_count;
+    output_buffer.sample_data_array.resize(size_t(output_frames) * resampler_state.channel_count);
+    resampler_state.working_samples.resize(size_t(history_length + input_frames));
+
+    for (int channel_index = 0; channel_index < resampler_state.channel_count; channel_index++) {
+        // The system joins the carried history with the new block in contiguous scratch
+        double* working_samples = resampler_state.working_samples.data();
+        double* channel_history = resampler_state.channel_history.data() + size_t(channel_index) * history_length;
+        copy(channel_history, channel_history + history_length, working_samples);
+        const double* input_plane = access_channel_plane(input_buffer, channel_index);
+        copy(input_plane, input_plane + input_frames, working_samples + history_length);
+
+        // The system evaluates one branch inner product per output sample
+        double* output_plane = access_channel_plane(output_buffer, channel_index);
+        int phase_position = resampler_state.phase_position;
+        int input_cursor = resampler_state.input_cursor;
+        for (int output_index = 0; output_index < output_frames; output_index++) {
+            output_plane[output_index] = polyphase_inner_product(
+                filter_bank.phase_coefficients.data() + size_t(phase_position) * POLYPHASE_TAPS_PER_PHASE,
+                working_samples + input_cursor);
+            phase_position += filter_bank.decimation_factor;
+            input_cursor += phase_position / filter_bank.interpolation_factor;
+            phase_position %= filter_bank.interpolation_factor;
+        }
+
+        // The system retains the trailing input samples for the following block
+        copy(working_samples + input_frames, working_samples + input_frames + history_length, channel_history);
+    }
+
+    // The system carries the phase schedule across the block boundary
+    resampler_state.phase_position = schedule_phase;
+    resampler_state.input_cursor = schedule_cursor - input_frames;
+}
+
+// Enumeration of time-stretch algorithms available to the preview engine
+enum time_stretch_mode {
+    STRETCH_WSOLA,                            // Waveform-similarity overlap-add for speech
+    STRETCH_PHASE_VOCODER                     // Phase vocoder for tonal music
+};
+
+// Structure definition for streaming time-stretch and pitch-shift state
+struct time_stretch_state {
+    time_stretch_mode stretch_mode;           // Selected stretching algorithm
+    double tempo_ratio;                       // Playback speed factor (2.0 plays twice as fast)
+    double pitch_ratio;                       // Frequency scaling factor (2.0 raises one octave)
+    int channel_count;                        // Number of planar channels processed
+    int frame_length;                         // Analysis and synthesis window length
+    int synthesis_hop;                        // Output advance per frame
+    double analysis_hop;                      // Input advance per frame
+    int search_tolerance;                     // WSOLA alignment search range in frames
+    int correlation_size;                     // Transform length for FFT cross-correlation
+    vector<double> analysis_window;           // Hann window shared by analysis and synthesis
+    vector<vector<double>> input_queue;       // Pending input samples per channel
+    long long input_queue_origin;             // Absolute input index of the first queued sample
+    double next_analysis_position;            // Absolute nominal position of the next frame
+    long long previous_frame_position;        // Absolute position of the last frame used or -1
+    vector<vector<double>> overlap_buffer;    // Overlap-add accumulator per channel
+    vector<vector<double>> previous_phase;    // Phase vocoder analysis phase per channel and bin
+    vector<vector<double>> synthesis_phase;   // Phase vocoder accumulated output phase per channel and bin
+    vector<vector<double>> stretched_queue;   // Stretched samples awaiting pitch resampling
+    double resample_position;                 // Fractional read position in the stretched queue
+    vector<double> transform_real;            // Transform scratch, real parts
+    vector<double> transform_imag;            // Transform scratch, imaginary parts
+    vector<double> template_real;             // Correlation template scratch, real parts
+    vector<double> template_imag;             // Correlation template scratch, imaginary parts
+    vector<double> segment_energy;            // WSOLA candidate segment energy per lag
+};
+
+// Function declaration for smallest power of two at or above a length
+int next_power_of_two(int minimum_length) {
+    // The system doubles the candidate until it covers the requested length
+    int power_value = 1;
+    while (power_value < minimum_length) {
+        power_value <<= 1;
+    }
+    return power_value;                        // Function returns power-of-two length
+}
+
+// Function declaration for time-stretch engine initialization
+time_stretch_state initialize_time_stretcher(time_stretch_mode stretch_mode, double tempo_ratio,
+                                             double pitch_ratio, int channel_count) {
+    time_stretch_state stretch_state;          // Local state structure instance
+    stretch_state.stretch_mode = stretch_mode;
+    stretch_state.tempo_ratio = tempo_ratio;
+    stretch_state.pitch_ratio = pitch_ratio;
+    stretch_state.channel_count = channel_count;
+
+    // The system chooses short windows with half overlap for speech and long windows with quarter hops for music
+    bool vocoder_mode = (stretch_mode == STRETCH_PHASE_VOCODER);
+    stretch_state.frame_length = vocoder_mode ? 2048 : 1024;
+    stretch_state.synthesis_hop = stretch_state.frame_length / (vocoder_mode ? 4 : 2);
+    stretch_state.search_tolerance = vocoder_mode ? 0 : stretch_state.frame_length / 4;
+
+    // The system stretches by the pitch ratio as well so the later resampling restores the tempo
+    double stretch_factor = pitch_ratio / tempo_ratio;
+    stretch_state.analysis_hop = stretch_state.synthesis_hop / stretch_factor;
+    stretch_state.correlation_size = next_power_of_two(stretch_state.frame_length + 2 * stretch_state.search_tolerance);
+
+    // The system uses the periodic Hann window that sums to a constant at the chosen hop, baked at the buffer size
+    stretch_state.analysis_window.resize(stretch_state.frame_length);
+    if (stretch_state.frame_length == AUDIO_BUFFER_SIZE) {
+        copy(HANN_WINDOW_TABLE.values, HANN_WINDOW_TABLE.values + AUDIO_BUFFER_SIZE, stretch_state.analysis_window.begin());
+    } else {
+        for (int sample_index = 0; sample_index < stretch_state.frame_length; sample_index++) {
+            stretch_state.analysis_window[sample_index] = 0.5 - 0.5 * cos(2.0 * M_PI * sample_index / stretch_state.frame_length);
+        }
+    }
+
+    // The system allocates per-channel queues and accumulators once
+    stretch_state.input_queue.assign(channel_count, vector<double>());
+    stretch_state.input_queue_origin = 0;
+    stretch_state.next_analysis_position = 0.0;
+    stretch_state.previous_frame_position = -1;
+    stretch_state.overlap_buffer.assign(channel_count, vector<double>(stretch_state.frame_length, 0.0));
+    stretch_state.previous_phase.assign(channel_count, vector<double>(stretch_state.frame_length / 2 + 1, 0.0));
+    stretch_state.synthesis_phase.assign(channel_count, vector<double>(stretch_state.frame_length / 2 + 1, 0.0));
+    stretch_state.stretched_queue.assign(channel_count, vector<double>());
+    stretch_state.resample_position = 0.0;
+    int scratch_size = max(stretch_state.frame_length, stretch_state.correlation_size);
+    stretch_state.transform_real.assign(scratch_size, 0.0);
+    stretch_state.transform_imag.assign(scratch_size, 0.0);
+    stretch_state.template_real.assign(scratch_size, 0.0);
+    stretch_state.template_imag.assign(scratch_size, 0.0);
+    stretch_state.segment_energy.assign(2 * stretch_state.search_tolerance + 1, 0.0);
+
+    return stretch_state;                      // Function returns prepared stretch state
+}
+
+// Function declaration for a mid-stream tempo change taking effect from the next analysis frame
+void set_time_stretch_tempo(time_stretch_state& stretch_state, double tempo_ratio) {
+    // The system ignores non-positive speeds and recomputes only the analysis hop, so queued input stays valid
+    if (tempo_ratio <= 0.0) {
+        return;
+    }
+    stretch_state.tempo_ratio = tempo_ratio;
+    stretch_state.analysis_hop = stretch_state.synthesis_hop * tempo_ratio / stretch_state.pitch_ratio;
+}
+
+// Function declaration for WSOLA alignment search through FFT cross-correlation
+int find_wsola_alignment_offset(time_stretch_state& stretch_state, long long template_position, long long nominal_position) {
+    int frame_length = stretch_state.frame_length;
+    int search_tolerance = stretch_state.search_tolerance;
+    int correlation_size = stretch_state.correlation_size;
+    const fft_transform_plan& transform_plan = acquire_fft_plan(correlation_size);
+    double channel_scale = 1.0 / stretch_state.channel_count;
+
+    // The system loads the channel-averaged search region and natural-continuation template
+    fill(stretch_state.transform_real.begin(), stretch_state.transform_real.begin() + correlation_size, 0.0);
+    fill(stretch_state.transform_imag.begin(), stretch_state.transform_imag.begin() + correlation_size, 0.0);
+    fill(stretch_state.template_real.begin(), stretch_state.template_real.begin() + correlation_size, 0.0);
+    fill(stretch_state.template_imag.begin(), stretch_state.template_imag.begin() + correlation_size, 0.0);
+    long long region_start = nominal_position - search_tolerance - stretch_state.input_queue_origin;
+    long long template_start = template_position - stretch_state.input_queue_origin;
+    for (int channel_index = 0; channel_index < stretch_state.channel_count; channel_index++) {
+        const vector<double>& channel_queue = stretch_state.input_queue[channel_index];
+        for (int sample_index = 0; sample_index < frame_length + 2 * search_tolerance; sample_index++) {
+            stretch_state.transform_real[sample_index] += channel_scale * channel_queue[region_start + sample_index];
+        }
+        for (int sample_index = 0; sample_index < frame_length; sample_index++) {
+            stretch_state.template_real[sample_index] += channel_scale * channel_queue[template_start + sample_index] *
+                                                         stretch_state.analysis_window[sample_index];
+        }
+    }
+
+    // The system measures each candidate segment's energy with a sliding sum before the region is transformed
+    double template_energy = 0.0;
+    for (int sample_index = 0; sample_index < frame_length; sample_index++) {
+        template_energy += stretch_state.template_real[sample_index] * stretch_state.template_real[sample_index];
+    }
+    double sliding_energy = 0.0;
+    for (int sample_index = 0; sample_index < frame_length; sample_index++) {
+        sliding_energy += stretch_state.transform_real[sample_index] * stretch_state.transform_real[sample_index];
+    }
+    for (int lag_index = 0; lag_index <= 2 * search_tolerance; lag_index++) {
+        stretch_state.segment_energy[lag_index] = max(sliding_energy, 0.0);
+        if (lag_index < 2 * search_tolerance) {
+            double leaving_sample = stretch_state.transform_real[lag_index];
+            double entering_sample = stretch_state.transform_real[lag_index + frame_length];
+            sliding_energy += entering_sample * entering_sample - leaving_sample * leaving_sample;
+        }
+    }
+
+    // The system multiplies the region spectrum by the conjugate template spectrum
+    execute_fft(transform_plan, stretch_state.transform_real.data(), stretch_state.transform_imag.data(), false);
+    execute_fft(transform_plan, stretch_state.template_real.data(), stretch_state.template_imag.data(), false);
+    for (int bin_index = 0; bin_index < correlation_size; bin_index++) {
+        double region_re = stretch_state.transform_real[bin_index];
+        double region_im = stretch_state.transform_imag[bin_index];
+        double template_re = stretch_state.template_real[bin_index];
+        double template_im = stretch_state.template_imag[bin_index];
+        stretch_state.transform_real[bin_index] = region_re * template_re + region_im * template_im;
+        stretch_state.transform_imag[bin_index] = region_im * template_re - region_re * template_im;
+    }
+    execute_fft(transform_plan, stretch_state.transform_real.data(), stretch_state.transform_imag.data(), true);
+
+    // The system picks the lag with the strongest energy-normalised correlation so loud segments carry no bias
+    int best_lag = search_tolerance;
+    double best_similarity = -2.0;
+    for (int lag_index = 0; lag_index <= 2 * search_tolerance; lag_index++) {
+        double similarity = stretch_state.transform_real[lag_index] /
+                            sqrt(stretch_state.segment_energy[lag_index] * template_energy + 1e-20);
+        if (similarity > best_similarity) {
+            best_similarity = similarity;
+            best_lag = lag_index;
+        }
+    }
+    return best_lag - search_tolerance;        // Function returns signed offset from the nominal position
+}
+
+// Function declaration for phase vocoder resynthesis of one frame into the overlap buffer
+void synthesize_phase_vocoder_frame(time_stretch_state& stretch_state, long long frame_position, double actual_analysis_hop) {
+    int frame_length = stretch_state.frame_length;
+    int spectrum_bins = frame_length / 2 + 1;
+    const fft_transform_plan& transform_plan = acquire_fft_plan(frame_length);
+    long long frame_offset = frame_position - stretch_state.input_queue_origin;
+    bool first_frame = stretch_state.previous_frame_position < 0;
+    double overlap_normalisation = 2.0 * stretch_state.synthesis_hop / (0.75 * frame_length);
+    double* transform_real = stretch_state.transform_real.data();
+    double* transform_imag = stretch_state.transform_imag.data();
+
+    for (int channel_index = 0; channel_index < stretch_state.channel_count; channel_index++) {
+        const vector<double>& channel_queue = stretch_state.input_queue[channel_index];
+        vector<double>& previous_phase = stretch_state.previous_phase[channel_index];
+        vector<double>& synthesis_phase = stretch_state.synthesis_phase[channel_index];
+
+        // The system transforms the windowed analysis frame
+        for (int sample_index = 0; sample_index < frame_length; sample_index++) {
+            transform_real[sample_index] = channel_queue[frame_offset + sample_index] * stretch_state.analysis_window[sample_index];
+            transform_imag[sample_index] = 0.0;
+        }
+        execute_fft(transform_plan, transform_real, transform_imag, false);
+
+        // The system advances each bin's output phase by its measured instantaneous frequency
+        for (int bin_index = 0; bin_index < spectrum_bins; bin_index++) {
+            double magnitude = sqrt(transform_real[bin_index] * transform_real[bin_index] +
+                                    transform_imag[bin_index] * transform_imag[bin_index]);
+            double analysis_phase = atan2(transform_imag[bin_index], transform_real[bin_index]);
+            double bin_frequency = 2.0 * M_PI * bin_index / frame_length;
+            if (first_frame) {
+                synthesis_phase[bin_index] = analysis_phase;
+            } else {
+                double phase_deviation = analysis_phase - previous_phase[bin_index] - bin_frequency * actual_analysis_hop;
+                phase_deviation -= 2.0 * M_PI * round(phase_deviation / (2.0 * M_PI));
+                double instantaneous_frequency = bin_frequency + phase_deviation / actual_analysis_hop;
+                synthesis_phase[bin_index] += instantaneous_frequency * stretch_state.synthesis_hop;
+            }
+            previous_phase[bin_index] = analysis_phase;
+            transform_real[bin_index] = magnitude * cos(synthesis_phase[bin_index]);
+            transform_imag[bin_index] = magnitude * sin(synthesis_phase[bin_index]);
+        }
+
+        // The system mirrors the spectrum for a real inverse transform and overlap-adds the windowed result
+        for (int bin_index = spectrum_bins; bin_index < frame_length; bin_index++) {
+            transform_real[bin_index] = transform_real[frame_length - bin_index];
+            transform_imag[bin_index] = -transform_imag[frame_length - bin_index];
+        }
+        execute_fft(transform_plan, transform_real, transform_imag, true);
+        vector<double>& overlap_buffer = stretch_state.overlap_buffer[channel_index];
+        for (int sample_index = 0; sample_index < frame_length; sample_index++) {
+            overlap_buffer[sample_index] += transform_real[sample_index] * stretch_state.analysis_window[sample_index] *
+                                            overlap_normalisation;
+        }
+    }
+}
+
+// Function declaration for streaming tempo and pitch modification of one planar block
+void process_time_stretch_block(time_stretch_state& stretch_state, const audio_processing_buffer& input_buffer,
+                                audio_processing_buffer& output_buffer) {
+    int frame_length = stretch_state.frame_length;
+    int synthesis_hop = stretch_state.synthesis_hop;
+    int search_tolerance = stretch_state.search_tolerance;
+    int input_frames = frames_per_channel(input_buffer);
+
+    // The system appends the incoming block to the per-channel input queues
+    for (int channel_index = 0; channel_index < stretch_state.channel_count; channel_index++) {
+        const double* input_plane = access_channel_plane(input_buffer, channel_index);
+        stretch_state.input_queue[channel_index].insert(stretch_state.input_queue[channel_index].end(),
+                                                        input_plane, input_plane + input_frames);
+    }
+    long long available_end = stretch_state.input_queue_origin + (long long)stretch_state.input_queue[0].size();
+
+    // Iterative loop produces one synthesis hop per frame while enough input is queued
+    while (true) {
+        long long nominal_position = llround(stretch_state.next_analysis_position);
+        long long template_position = stretch_state.previous_frame_position + synthesis_hop;
+        bool search_alignment = stretch_state.stretch_mode == STRETCH_WSOLA &&
+                                stretch_state.previous_frame_position >= 0 &&
+                                nominal_position - search_tolerance >= stretch_state.input_queue_origin;
+        long long required_end = nominal_position + frame_length + (search_alignment ? search_tolerance : 0);
+        if (stretch_state.stretch_mode == STRETCH_WSOLA && stretch_state.previous_frame_position >= 0) {
+            required_end = max(required_end, template_position + frame_length);
+        }
+        if (required_end > available_end) {
+            break;
+        }
+
+        long long frame_position = nominal_position;
+        if (stretch_state.stretch_mode == STRETCH_WSOLA) {
+            // The system aligns the frame with the natural continuation of the previous segment
+            if (search_alignment) {
+                frame_position += find_wsola_alignment_offset(stretch_state, template_position, nominal_position);
+            }
+            for (int channel_index = 0; channel_index < stretch_state.channel_count; channel_index++) {
+                const double* frame_samples = stretch_state.input_queue[channel_index].data() +
+                                              (frame_position - stretch_state.input_queue_origin);
+                vector<double>& overlap_buffer = stretch_state.overlap_buffer[channel_index];
+                for (int sample_index = 0; sample_index < frame_length; sample_index++) {
+                    overlap_buffer[sample_index] += frame_samples[sample_index] * stretch_state.analysis_window[sample_index];
+                }
+            }
+        } else {
+            double actual_analysis_hop = stretch_state.previous_frame_position >= 0 ?
+                double(frame_position - stretch_state.previous_frame_position) : stretch_state.analysis_hop;
+            synthesize_phase_vocoder_frame(stretch_state, frame_position, max(actual_analysis_hop, 1.0));
+        }
+
+        // The system releases one completed hop from the overlap buffer into the stretched queue
+        for (int channel_index = 0; channel_index < stretch_state.channel_count; channel_index++) {
+            vector<double>& overlap_buffer = stretch_state.overlap_buffer[channel_index];
+            stretch_state.stretched_queue[channel_index].insert(stretch_state.stretched_queue[channel_index].end(),
+                                                                overlap_buffer.begin(), overlap_buffer.begin() + synthesis_hop);
+            copy(overlap_buffer.begin() + synthesis_hop, overlap_buffer.end(), overlap_buffer.begin());
+            fill(overlap_buffer.end() - synthesis_hop, overlap_buffer.end(), 0.0);
+        }
+        stretch_state.previous_frame_position = frame_position;
+        stretch_state.next_analysis_position += stretch_state.analysis_hop;
+
+        // The system discards input no later frame or template can reach
+        long long retain_from = min((long long)llround(stretch_state.next_analysis_position) - search_tolerance,
+                                    stretch_state.previous_frame_position + (stretch_state.stretch_mode == STRETCH_WSOLA ?
+                                                                             synthesis_hop : 0));
+        long long discard_count = max(0LL, retain_from - stretch_state.input_queue_origin);
+        if (discard_count > 0) {
+            for (int channel_index = 0; channel_index < stretch_state.channel_count; channel_index++) {
+                vector<double>& channel_queue = stretch_state.input_queue[channel_index];
+                channel_queue.erase(channel_queue.begin(), channel_queue.begin() + min<long long>(discard_count, channel_queue.size()));
+            }
+            stretch_state.input_queue_origin += discard_count;
+        }
+    }
+
+    // The system reads the stretched signal at the pitch ratio to restore tempo and shift pitch
+    int stretched_frames = int(stretch_state.stretched_queue[0].size());
+    int output_frames = 0;
+    while (stretch_state.resample_position + output_frames * stretch_state.pitch_ratio + 1.0 < stretched_frames) {
+        output_frames++;
+    }
+    output_buffer.channel_count = stretch_state.channel_count;
+    output_buffer.sample_data_array.resize(size_t(output_frames) * stretch_state.channel_count);
+    for (int channel_index = 0; channel_index < stretch_state.channel_count; channel_index++) {
+        const vector<double>& stretched_samples = stretch_state.stretched_queue[channel_index];
+        double* output_plane = access_channel_plane(output_buffer, channel_index);
+        for (int output_index = 0; output_index < output_frames; output_index++) {
+            double read_position = stretch_state.resample_position + output_index * stretch_state.pitch_ratio;
+            int base_index = int(read_position);
+            double fraction = read_position - base_index;
+            output_plane[output_index] = stretched_samples[base_index] +
+                                         fraction * (stretched_samples[base_index + 1] - stretched_samples[base_index]);
+        }
+    }
+
+    // The system drops fully consumed stretched samples and keeps the fractional read position
+    double next_read_position = stretch_state.resample_position + output_frames * stretch_state.pitch_ratio;
+    int consumed_frames = min(stretched_frames, int(next_read_position));
+    for (int channel_index = 0; channel_index < stretch_state.channel_count; channel_index++) {
+        vector<double>& stretched_samples = stretch_state.stretched_queue[channel_index];
+        stretched_samples.erase(stretched_samples.begin(), stretched_samples.begin() + consumed_frames);
+    }
+    stretch_state.resample_position = next_read_position - consumed_frames;
+}
+
+// Function declaration for zero-crossing frequency estimation used in preview validation
+double estimate_zero_crossing_frequency(const vector<double>& signal_samples) {
+    // The system counts rising zero crossings across the signal
+    int rising_crossings = 0;
+    for (size_t sample_index = 1; sample_index < signal_samples.size(); sample_index++) {
+        rising_crossings += (signal_samples[sample_index - 1] < 0.0 && signal_samples[sample_index] >= 0.0) ? 1 : 0;
+    }
+    return signal_samples.empty() ? 0.0 : rising_crossings * SAMPLE_RATE / signal_samples.size();
+}
+
+// Enumeration of output limiting behaviours applied after mixing
+enum saturation_mode {
+    SATURATION_NONE,                          // Leave the summed signal unbounded
+    SATURATION_HARD,                          // Clamp the summed signal at the ceiling
+    SATURATION_SOFT                           // Rational tanh approximation approaching the ceiling
+};
+
+// Number of input streams accumulated together per pass over the output tile
+const int MIXER_STREAMS_PER_PASS = 4;
+
+// Output frames per mixer tile kept resident in cache while stream groups accumulate
+const int MIXER_TILE_FRAMES = 256;
+
+// Structure definition for N-stream mixer gains and limiting configuration
+struct audio_mixer_state {
+    vector<double> current_gain;              // Gain reached at the end of the previous block per stream
+    vector<double> target_gain;               // Gain approached linearly across the next block per stream
+    saturation_mode output_saturation;        // Limiting applied to the mixed output
+    double saturation_ceiling;                // Absolute output ceiling for limiting
+};
+
+// Function declaration for mixer state initialization with unity gains
+audio_mixer_state initialize_audio_mixer(int stream_count, saturation_mode output_saturation, double saturation_ceiling = 1.0) {
+    audio_mixer_state mixer_state;             // Local state structure instance
+
+    // The system starts every stream at unity gain with no pending ramp
+    mixer_state.current_gain.assign(stream_count, 1.0);
+    mixer_state.target_gain.assign(stream_count, 1.0);
+    mixer_state.output_saturation = output_saturation;
+    mixer_state.saturation_ceiling = saturation_ceiling;
+
+    return mixer_state;                        // Function returns prepared mixer state
+}
+
+// Function declaration for branch-free output limiting over a contiguous span
+void apply_output_saturation(double* sample_data, int sample_count, saturation_mode output_saturation, double saturation_ceiling) {
+    double inverse_ceiling = 1.0 / saturation_ceiling;
+    if (output_saturation == SATURATION_HARD) {
+        // The system clamps with min and max so the loop compiles to vector compares
+        for (int sample_index = 0; sample_index < sample_count; sample_index++) {
+            sample_data[sample_index] = max(-saturation_ceiling, min(saturation_ceiling, sample_data[sample_index]));
+        }
+    } else if (output_saturation == SATURATION_SOFT) {
+        // The system applies a rational tanh approximation on the clamped normalised range
+        for (int sample_index = 0; sample_index < sample_count; sample_index++) {
+            double normalised = max(-3.0, min(3.0, sample_data[sample_index] * inverse_ceiling));
+            double squared = normalised * normalised;
+            sample_data[sample_index] = saturation_ceiling * normalised * (27.0 + squared) / (27.0 + 9.0 * squared);
+        }
+    }
+}
+
+// Function declaration for tiled N-stream mixing with per-stream gain ramps
+void mix_audio_streams(audio_mixer_state& mixer_state, const vector<const audio_processing_buffer*>& input_streams,
+                       audio_processing_buffer& output_buffer) {
+    int stream_count = int(input_streams.size());
+    int frame_total = stream_count > 0 && input_streams[0] ? frames_per_channel(*input_streams[0]) : 0;
+    int channel_total = stream_count > 0 && input_streams[0] ? max(input_streams[0]->channel_count, 0) : 0;
+    output_buffer.channel_count = channel_total;
+    output_buffer.sample_data_array.assign(size_t(frame_total) * channel_total, 0.0);
+    double inverse_frames = frame_total > 0 ? 1.0 / frame_total : 0.0;
+
+    // The system feeds padding lanes and mismatched streams from a shared silent tile rather than the output
+    static const double silent_tile[MIXER_TILE_FRAMES] = {0.0};
+    auto stream_layout_matches = [&](int stream_index) {
+        const audio_processing_buffer* input_stream = input_streams[stream_index];
+        return input_stream && stream_index < int(mixer_state.current_gain.size()) &&
+               input_stream->channel_count == channel_total && frames_per_channel(*input_stream) == frame_total;
+    };
+
+    for (int channel_index = 0; channel_index < channel_total; channel_index++) {
+        double* output_plane = access_channel_plane(output_buffer, channel_index);
+
+        // Iterative loop keeps one output tile in cache while every stream group is folded into it
+        for (int tile_start = 0; tile_start < frame_total; tile_start += MIXER_TILE_FRAMES) {
+            int tile_length = min(MIXER_TILE_FRAMES, frame_total - tile_start);
+            double* output_tile = output_plane + tile_start;
+
+            for (int group_start = 0; group_start < stream_count; group_start += MIXER_STREAMS_PER_PASS) {
+                // The system gathers up to four stream tiles with their ramp origins and slopes, padding with silence
+                const double* stream_tile[MIXER_STREAMS_PER_PASS];
+                double ramp_origin[MIXER_STREAMS_PER_PASS];
+                double ramp_slope[MIXER_STREAMS_PER_PASS];
+                for (int lane_index = 0; lane_index < MIXER_STREAMS_PER_PASS; lane_index++) {
+                    int stream_index = group_start + lane_index;
+                    if (stream_index < stream_count && stream_layout_matches(stream_index)) {
+                        double gain_step = (mixer_state.target_gain[stream_index] - mixer_state.current_gain[stream_index]) * inverse_frames;
+                        stream_tile[lane_index] = access_channel_plane(*input_streams[stream_index], channel_index) + tile_start;
+                        ramp_origin[lane_index] = mixer_state.current_gain[stream_index] + gain_step * (tile_start + 1);
+                        ramp_slope[lane_index] = gain_step;
+                    } else {
+                        stream_tile[lane_index] = silent_tile;
+                        ramp_origin[lane_index] = 0.0;
+                        ramp_slope[lane_index] = 0.0;
+                    }
+                }
+
+                // The system reads four streams per pass so each output sample is loaded and stored once per group
+                for (int frame_index = 0; frame_index < tile_length; frame_index++) {
+                    double frame_position = double(frame_index);
+                    output_tile[frame_index] +=
+                        (ramp_origin[0] + ramp_slope[0] * frame_position) * stream_tile[0][frame_index] +
+                        (ramp_origin[1] + ramp_slope[1] * frame_position) * stream_tile[1][frame_index] +
+                        (ramp_origin[2] + ramp_slope[2] * frame_position) * stream_tile[2][frame_index] +
+                        (ramp_origin[3] + ramp_slope[3] * frame_position) * stream_tile[3][frame_index];
+                }
+            }
+
+            // The system limits the finished tile while it is still cache resident
+            apply_output_saturation(output_tile, tile_length, mixer_state.output_saturation, mixer_state.saturation_ceiling);
+        }
+    }
+
+    // The system completes every gain ramp at the block boundary
+    for (int stream_index = 0; stream_index < min(stream_count, int(mixer_state.current_gain.size())); stream_index++) {
+        mixer_state.current_gain[stream_index] = mixer_state.target_gain[stream_index];
+    }
+}
+
+// Enumeration of sample storage formats handled at input and output edges
+enum sample_storage_format {
+    SAMPLE_FORMAT_FLOAT64,                    // 64-bit IEEE floating point
+    SAMPLE_FORMAT_FLOAT32,                    // 32-bit IEEE floating point
+    SAMPLE_FORMAT_INT16,                      // 16-bit signed integer
+    SAMPLE_FORMAT_INT24                       // 24-bit signed integer packed in three little-endian bytes
+};
+
+// Samples converted per stack-resident chunk during format conversion
+const int CONVERSION_CHUNK_SAMPLES = 1024;
+
+// Structure definition for TPDF dither and noise-shaping state used on reduction to 16-bit
+struct dither_generator_state {
+    bool tpdf_dither_enabled;                 // Flag adding triangular dither before quantisation
+    bool noise_shaping_enabled;               // Flag applying second-order error feedback
+    uint64_t lane_seed[SIMD_LANE_COUNT];      // Independent xorshift generators, one per SIMD lane
+    vector<double> shaping_history;           // Two previous quantisation errors per channel
+};
+
+// Function declaration for storage size lookup of a sample format
+int bytes_per_sample(sample_storage_format storage_format) {
+    // The system maps each format to its packed byte width
+    switch (storage_format) {
+        case SAMPLE_FORMAT_FLOAT64: return 8;
+        case SAMPLE_FORMAT_FLOAT32: return 4;
+        case SAMPLE_FORMAT_INT16:   return 2;
+        case SAMPLE_FORMAT_INT24:   return 3;
+    }
+    return 0;
+}
+
+// Function declaration for vectorizable conversion from stored samples into double precision
+void convert_to_double(const uint8_t* source_bytes, sample_storage_format storage_format,
+                       double* destination_samples, int sample_count) {
+    // The system widens each format in a dedicated straight-line loop, loading through memcpy for alignment and aliasing safety
+    if (storage_format == SAMPLE_FORMAT_FLOAT64) {
+        memcpy(destination_samples, source_bytes, size_t(sample_count) * sizeof(double));
+    } else if (storage_format == SAMPLE_FORMAT_FLOAT32) {
+        for (int sample_index = 0; sample_index < sample_count; sample_index++) {
+            float source_value;
+            memcpy(&source_value, source_bytes + size_t(sample_index) * sizeof(float), sizeof(float));
+            destination_samples[sample_index] = source_value;
+        }
+    } else if (storage_format == SAMPLE_FORMAT_INT16) {
+        for (int sample_index = 0; sample_index < sample_count; sample_index++) {
+            int16_t source_value;
+            memcpy(&source_value, source_bytes + size_t(sample_index) * sizeof(int16_t), sizeof(int16_t));
+            destination_samples[sample_index] = source_value * (1.0 / 32768.0);
+        }
+    } else {
+        for (int sample_index = 0; sample_index < sample_count; sample_index++) {
+            const uint8_t* packed_sample = source_bytes + 3 * sample_index;
+            int32_t assembled_value = int32_t(uint32_t(packed_sample[0]) << 8 | uint32_t(packed_sample[1]) << 16 |
+                                              uint32_t(packed_sample[2]) << 24) >> 8;
+            destination_samples[sample_index] = assembled_value * (1.0 / 8388608.0);
+        }
+    }
+}
+
+// Function declaration for vectorizable conversion from double precision into stored samples
+void convert_from_double(const double* source_samples, sample_storage_format storage_format,
+                         uint8_t* destination_bytes, int sample_count) {
+    // The system rounds half away from zero with copysign and clamps, avoiding per-sample library calls
+    if (storage_format == SAMPLE_FORMAT_FLOAT64) {
+        memcpy(destination_bytes, source_samples, size_t(sample_count) * sizeof(double));
+    } else if (storage_format == SAMPLE_FORMAT_FLOAT32) {
+        for (int sample_index = 0; sample_index < sample_count; sample_index++) {
+            float destination_value = float(source_samples[sample_index]);
+            memcpy(destination_bytes + size_t(sample_index) * sizeof(float), &destination_value, sizeof(float));
+        }
+    } else if (storage_format == SAMPLE_FORMAT_INT16) {
+        for (int sample_index = 0; sample_index < sample_count; sample_index++) {
+            double scaled_value = source_samples[sample_index] * 32768.0;
+            scaled_value = max(-32768.0, min(32767.0, scaled_value + copysign(0.5, scaled_value)));
+            int16_t destination_value = int16_t(scaled_value);
+            memcpy(destination_bytes + size_t(sample_index) * sizeof(int16_t), &destination_value, sizeof(int16_t));
+        }
+    } else {
+        for (int sample_index = 0; sample_index < sample_count; sample_index++) {
+            double scaled_value = source_samples[sample_index] * 8388608.0;
+            scaled_value = max(-8388608.0, min(8388607.0, scaled_value + copysign(0.5, scaled_value)));
+            uint32_t packed_value = uint32_t(int32_t(scaled_value));
+            uint8_t* packed_sample = destination_bytes + 3 * sample_index;
+            packed_sample[0] = uint8_t(packed_value);
+            packed_sample[1] = uint8_t(packed_value >> 8);
+            packed_sample[2] = uint8_t(packed_value >> 16);
+        }
+    }
+}
+
+// Function declaration for conversion between any pair of stored sample formats
+void convert_sample_format(const uint8_t* source_bytes, sample_storage_format source_format,
+                           uint8_t* destination_bytes, sample_storage_format destination_format, int sample_count) {
+    // The system routes every pair through a stack-resident double chunk so each direction uses one vector kernel
+    double conversion_chunk[CONVERSION_CHUNK_SAMPLES];
+    int source_width = bytes_per_sample(source_format);
+    int destination_width = bytes_per_sample(destination_format);
+    for (int chunk_start = 0; chunk_start < sample_count; chunk_start += CONVERSION_CHUNK_SAMPLES) {
+        int chunk_length = min(CONVERSION_CHUNK_SAMPLES, sample_count - chunk_start);
+        convert_to_double(source_bytes + size_t(chunk_start) * source_width, source_format, conversion_chunk, chunk_length);
+        convert_from_double(conversion_chunk, destination_format, destination_bytes + size_t(chunk_start) * destination_width,
+                            chunk_length);
+    }
+}
+
+// Function declaration for dither generator initialization
+dither_generator_state initialize_dither_generator(int channel_count, bool tpdf_dither_enabled, bool noise_shaping_enabled,
+                                                   uint64_t seed_value = 0x9E3779B97F4A7C15ULL) {
+    dither_generator_state dither_state;       // Local state structure instance
+    dither_state.tpdf_dither_enabled = tpdf_dither_enabled;
+    dither_state.noise_shaping_enabled = noise_shaping_enabled;
+
+    // The system derives distinct non-zero seeds for every lane
+    for (int lane_index = 0; lane_index < SIMD_LANE_COUNT; lane_index++) {
+        dither_state.lane_seed[lane_index] = (seed_value + 0x632BE59BD9B4E019ULL * (lane_index + 1)) | 1ULL;
+    }
+    dither_state.shaping_history.assign(size_t(channel_count) * 2, 0.0);
+
+    return dither_state;                       // Function returns prepared dither state
+}
+
+// Function declaration for TPDF dither and noise-shaped requantisation of one channel chunk to 16-bit steps
+void apply_dither_to_chunk(dither_generator_state& dither_state, double* chunk_samples, int sample_count, int channel_index) {
+    // The system draws two uniform values per sample from lane-parallel xorshift generators
+    double triangular_noise[CONVERSION_CHUNK_SAMPLES];
+    int padded_count = (sample_count + SIMD_LANE_COUNT - 1) / SIMD_LANE_COUNT * SIMD_LANE_COUNT;
+    for (int sample_index = 0; sample_index < padded_count; sample_index += SIMD_LANE_COUNT) {
+        for (int lane_index = 0; lane_index < SIMD_LANE_COUNT; lane_index++) {
+            uint64_t& lane_seed = dither_state.lane_seed[lane_index];
+            lane_seed ^= lane_seed >> 12; lane_seed ^= lane_seed << 25; lane_seed ^= lane_seed >> 27;
+            double first_uniform = double((lane_seed * 0x2545F4914F6CDD1DULL) >> 11) * 0x1.0p-53;
+            lane_seed ^= lane_seed >> 12; lane_seed ^= lane_seed << 25; lane_seed ^= lane_seed >> 27;
+            double second_uniform = double((lane_seed * 0x2545F4914F6CDD1DULL) >> 11) * 0x1.0p-53;
+            if (sample_index + lane_index < CONVERSION_CHUNK_SAMPLES) {
+                triangular_noise[sample_index + lane_index] = dither_state.tpdf_dither_enabled ?
+                                                              first_uniform - second_uniform : 0.0;
+            }
+        }
+    }
+
+    const double quantisation_scale = 32768.0;
+    if (!dither_state.noise_shaping_enabled) {
+        // The system adds dither directly and leaves rounding to the output conversion kernel
+        for (int sample_index = 0; sample_index < sample_count; sample_index++) {
+            chunk_samples[sample_index] += triangular_noise[sample_index] * (1.0 / quantisation_scale);
+        }
+        return;
+    }
+
+    // The system feeds back the last two quantisation errors so the noise transfer is (1 - z^-1)^2
+    double& previous_error = dither_state.shaping_history[size_t(channel_index) * 2];
+    double& older_error = dither_state.shaping_history[size_t(channel_index) * 2 + 1];
+    for (int sample_index = 0; sample_index < sample_count; sample_index++) {
+        double shaped_target = chunk_samples[sample_index] * quantisation_scale - 2.0 * previous_error + older_error;
+        double quantised_value = floor(shaped_target + triangular_noise[sample_index] + 0.5);
+        quantised_value = max(-32768.0, min(32767.0, quantised_value));
+        older_error = previous_error;
+        previous_error = max(-4.0, min(4.0, quantised_value - shaped_target));
+        chunk_samples[sample_index] = quantised_value / quantisation_scale;
+    }
+}
+
+// Function declaration for feeding stored interleaved or planar samples into a planar buffer
+void import_samples_to_buffer(const uint8_t* source_bytes, sample_storage_format source_format, int frame_count,
+                              int channel_count, bool interleaved_layout, audio_processing_buffer& target_buffer) {
+    target_buffer.channel_count = channel_count;
+    target_buffer.sample_data_array.resize(size_t(frame_count) * channel_count);
+    int sample_width = bytes_per_sample(source_format);
+
+    // The system converts planar sources straight into their destination planes
+    if (!interleaved_layout) {
+        convert_to_double(source_bytes, source_format, target_buffer.sample_data_array.data(), frame_count * channel_count);
+        return;
+    }
+
+    // The system widens interleaved chunks contiguously and then scatters frames into planes
+    double conversion_chunk[CONVERSION_CHUNK_SAMPLES];
+    int chunk_frames = max(1, CONVERSION_CHUNK_SAMPLES / channel_count);
+    for (int frame_start = 0; frame_start < frame_count; frame_start += chunk_frames) {
+        int frame_length = min(chunk_frames, frame_count - frame_start);
+        convert_to_double(source_bytes + size_t(frame_start) * channel_count * sample_width, source_format,
+                          conversion_chunk, frame_length * channel_count);
+        for (int channel_index = 0; channel_index < channel_count; channel_index++) {
+            double* channel_plane = access_channel_plane(target_buffer, channel_index) + frame_start;
+            for (int frame_index = 0; frame_index < frame_length; frame_index++) {
+                channel_plane[frame_index] = conversion_chunk[frame_index * channel_count + channel_index];
+            }
+        }
+    }
+}
+
+// Function declaration for draining a planar buffer into interleaved or planar stored samples
+void export_buffer_to_samples(const audio_processing_buffer& source_buffer, sample_storage_format destination_format,
+                              bool interleaved_layout, vector<uint8_t>& destination_bytes,
+                              dither_generator_state* dither_state = nullptr) {
+    int channel_count = source_buffer.channel_count;
+    int frame_count = frames_per_channel(source_buffer);
+    int sample_width = bytes_per_sample(destination_format);
+    destination_bytes.resize(size_t(frame_count) * channel_count * sample_width);
+    bool dither_active = dither_state && destination_format == SAMPLE_FORMAT_INT16;
+
+    // The system stages planar chunks per channel, dithers them, then interleaves when requested
+    double planar_chunk[CONVERSION_CHUNK_SAMPLES];
+    double interleaved_chunk[CONVERSION_CHUNK_SAMPLES];
+    int chunk_frames = interleaved_layout ? max(1, CONVERSION_CHUNK_SAMPLES / channel_count) : CONVERSION_CHUNK_SAMPLES;
+    for (int frame_start = 0; frame_start < frame_count; frame_start += chunk_frames) {
+        int frame_length = min(chunk_frames, frame_count - frame_start);
+        for (int channel_index = 0; channel_index < channel_count; channel_index++) {
+            const double* channel_plane = access_channel_plane(source_buffer, channel_index) + frame_start;
+            copy(channel_plane, channel_plane + frame_length, planar_chunk);
+            if (dither_active) {
+                apply_dither_to_chunk(*dither_state, planar_chunk, frame_length, channel_index);
+            }
+            if (interleaved_layout) {
+                for (int frame_index = 0; frame_index < frame_length; frame_index++) {
+                    interleaved_chunk[frame_index * channel_count + channel_index] = planar_chunk[frame_index];
+                }
+            } else {
+                convert_from_double(planar_chunk, destination_format,
+                                    destination_bytes.data() + (size_t(channel_index) * frame_count + frame_start) * sample_width,
+                                    frame_length);
+            }
+        }
+        if (interleaved_layout) {
+            convert_from_double(interleaved_chunk, destination_format,
+                                destination_bytes.data() + size_t(frame_start) * channel_count * sample_width,
+                                frame_length * channel_count);
+        }
+    }
+}
+
+// Enumeration of spectral gain rules available to the noise reducer
+enum noise_reduction_method {
+    NOISE_SPECTRAL_SUBTRACTION,               // Power spectral subtraction with over-subtraction
+    NOISE_WIENER_GAIN                         // Wiener-style gain 1 - aN/P from the posterior signal-to-noise ratio
+};
+
+// Structure definition for streaming STFT noise reducer state
+struct noise_reducer_state {
+    noise_reduction_method reduction_method;  // Selected spectral gain rule
+    int channel_count;                        // Number of planar channels processed
+    int frame_length;                         // STFT frame length
+    int hop_length;                           // STFT hop and output block length
+    int spectrum_bins;                        // Non-redundant bins per frame
+    const fft_transform_plan* transform_plan; // Shared plan for the frame length
+    double silence_threshold_level;           // Linear peak below which frames update the profile
+    double over_subtraction_factor;           // Noise power multiplier applied before subtraction
+    double spectral_floor;                    // Minimum gain retained in every bin
+    double profile_smoothing;                 // Exponential averaging weight for new noise frames
+    long long learned_frame_count;            // Silent frames contributing to the profile
+    vector<double> noise_power_profile;       // Learned noise power per channel and bin
+    vector<double> input_history;             // Most recent frame of input per channel
+    vector<double> overlap_buffer;            // Overlap-add accumulator per channel
+    vector<double> output_block;              // Completed output hop per channel
+    int hop_fill_position;                    // Frames exchanged into the current hop
+};
+
+// Function declaration for shared square-root Hann window lookup per frame length
+const double* acquire_sqrt_hann_window(int frame_length) {
+    // The system serves the baked table at the buffer size and builds other lengths once like the transform plans
+    if (frame_length == AUDIO_BUFFER_SIZE) {
+        return SQRT_HANN_WINDOW_TABLE.values;
+    }
+    static map<int, vector<double>> window_cache;
+    static mutex window_cache_mutex;
+    lock_guard<mutex> cache_lock(window_cache_mutex);
+    vector<double>& cached_window = window_cache[frame_length];
+    if (cached_window.empty()) {
+        cached_window.resize(frame_length);
+        for (int sample_index = 0; sample_index < frame_length; sample_index++) {
+            cached_window[sample_index] = sin(M_PI * sample_index / frame_length);
+        }
+    }
+    return cached_window.data();               // Function returns the cached window
+}
+
+// Function declaration for noise reducer initialization
+noise_reducer_state initialize_noise_reducer(noise_reduction_method reduction_method, int channel_count,
+                                             const silence_detector_configuration& silence_configuration,
+                                             double over_subtraction_factor = 1.5, double spectral_floor = 0.05) {
+    noise_reducer_state reducer_state;         // Local state structure instance
+    reducer_state.reduction_method = reduction_method;
+    reducer_state.channel_count = channel_count;
+
+    // The system uses half-overlapped square-root Hann frames so analysis and synthesis windows reconstruct exactly
+    reducer_state.frame_length = AUDIO_BUFFER_SIZE;
+    reducer_state.hop_length = AUDIO_BUFFER_SIZE / 2;
+    reducer_state.spectrum_bins = reducer_state.frame_length / 2 + 1;
+    reducer_state.transform_plan = &acquire_fft_plan(reducer_state.frame_length);
+    reducer_state.silence_threshold_level = pow(10.0, silence_configuration.threshold_db / 20.0);
+    reducer_state.over_subtraction_factor = over_subtraction_factor;
+    reducer_state.spectral_floor = spectral_floor;
+    reducer_state.profile_smoothing = 0.1;
+    reducer_state.learned_frame_count = 0;
+
+    // The system keeps only per-channel spectra and time-domain staging in the stream state
+    reducer_state.noise_power_profile.assign(size_t(channel_count) * reducer_state.spectrum_bins, 0.0);
+    reducer_state.input_history.assign(size_t(channel_count) * reducer_state.frame_length, 0.0);
+    reducer_state.overlap_buffer.assign(size_t(channel_count) * reducer_state.frame_length, 0.0);
+    reducer_state.output_block.assign(size_t(channel_count) * reducer_state.hop_length, 0.0);
+    reducer_state.hop_fill_position = 0;
+
+    return reducer_state;                      // Function returns prepared reducer state
+}
+
+// Function declaration for one STFT frame of noise learning, gain application and overlap-add
+void process_noise_reduction_frame(noise_reducer_state& reducer_state) {
+    int frame_length = reducer_state.frame_length;
+    int hop_length = reducer_state.hop_length;
+    int spectrum_bins = reducer_state.spectrum_bins;
+    const double* frame_window = acquire_sqrt_hann_window(frame_length);
+
+    // The system borrows thread-local transform scratch so stream state holds no per-stream FFT buffers
+    thread_local vector<double> transform_real;
+    thread_local vector<double> transform_imag;
+    transform_real.resize(frame_length);
+    transform_imag.resize(frame_length);
+
+    // The system treats the frame as noise only when every channel stays under the silence threshold
+    double frame_peak = 0.0;
+    for (int channel_index = 0; channel_index < reducer_state.channel_count; channel_index++) {
+        frame_peak = max(frame_peak, compute_block_peak_level(
+            reducer_state.input_history.data() + size_t(channel_index) * frame_length, frame_length));
+    }
+    bool noise_only_frame = frame_peak < reducer_state.silence_threshold_level;
+    double profile_weight = reducer_state.learned_frame_count == 0 ? 1.0 :
+                            max(reducer_state.profile_smoothing, 1.0 / (reducer_state.learned_frame_count + 1));
+
+    for (int channel_index = 0; channel_index < reducer_state.channel_count; channel_index++) {
+        const double* input_history = reducer_state.input_history.data() + size_t(channel_index) * frame_length;
+        double* noise_profile = reducer_state.noise_power_profile.data() + size_t(channel_index) * spectrum_bins;
+        double* overlap_buffer = reducer_state.overlap_buffer.data() + size_t(channel_index) * frame_length;
+
+        // The system transforms the windowed frame
+        for (int sample_index = 0; sample_index < frame_length; sample_index++) {
+            transform_real[sample_index] = input_history[sample_index] * frame_window[sample_index];
+            transform_imag[sample_index] = 0.0;
+        }
+        execute_fft(*reducer_state.transform_plan, transform_real.data(), transform_imag.data(), false);
+
+        // The system computes a real gain per bin from the learned noise power
+        for (int bin_index = 0; bin_index < spectrum_bins; bin_index++) {
+            double frame_power = transform_real[bin_index] * transform_real[bin_index] +
+                                 transform_imag[bin_index] * transform_imag[bin_index];
+            if (noise_only_frame) {
+                noise_profile[bin_index] += profile_weight * (frame_power - noise_profile[bin_index]);
+            }
+            double noise_ratio = reducer_state.over_subtraction_factor * noise_profile[bin_index] / (frame_power + 1e-30);
+            double wiener_gain = max(reducer_state.spectral_floor, 1.0 - noise_ratio);
+            double bin_gain = reducer_state.reduction_method == NOISE_WIENER_GAIN ? wiener_gain :
+                              sqrt(max(reducer_state.spectral_floor * reducer_state.spectral_floor, 1.0 - noise_ratio));
+            bin_gain = reducer_state.learned_frame_count == 0 && !noise_only_frame ? 1.0 : bin_gain;
+            transform_real[bin_index] *= bin_gain;
+            transform_imag[bin_index] *= bin_gain;
+        }
+
+        // The system mirrors the modified spectrum, inverts it and overlap-adds the synthesis-windowed frame
+        for (int bin_index = spectrum_bins; bin_index < frame_length; bin_index++) {
+            transform_real[bin_index] = transform_real[frame_length - bin_index];
+            transform_imag[bin_index] = -transform_imag[frame_length - bin_index];
+        }
+        execute_fft(*reducer_state.transform_plan, transform_real.data(), transform_imag.data(), true);
+        for (int sample_index = 0; sample_index < frame_length; sample_index++) {
+            overlap_buffer[sample_index] += transform_real[sample_index] * frame_window[sample_index];
+        }
+
+        // The system releases the completed hop and shifts the accumulator
+        copy(overlap_buffer, overlap_buffer + hop_length, reducer_state.output_block.begin() + size_t(channel_index) * hop_length);
+        copy(overlap_buffer + hop_length, overlap_buffer + frame_length, overlap_buffer);
+        fill(overlap_buffer + frame_length - hop_length, overlap_buffer + frame_length, 0.0);
+    }
+
+    if (noise_only_frame) {
+        reducer_state.learned_frame_count++;
+    }
+}
+
+// Function declaration for in-place streaming noise reduction of one planar buffer
+void apply_noise_reduction(audio_processing_buffer& target_buffer, noise_reducer_state& reducer_state) {
+    int frame_total = frames_per_channel(target_buffer);
+    int frame_length = reducer_state.frame_length;
+    int hop_length = reducer_state.hop_length;
+    int channel_total = min(target_buffer.channel_count, reducer_state.channel_count);
+    int frame_position = 0;
+
+    // Iterative loop exchanges input for denoised output one hop at a time
+    while (frame_position < frame_total) {
+        int exchange_length = min(hop_length - reducer_state.hop_fill_position, frame_total - frame_position);
+        for (int channel_index = 0; channel_index < channel_total; channel_index++) {
+            double* channel_plane = access_channel_plane(target_buffer, channel_index) + frame_position;
+            double* history_slot = reducer_state.input_history.data() + size_t(channel_index) * frame_length +
+                                   (frame_length - hop_length) + reducer_state.hop_fill_position;
+            const double* output_slot = reducer_state.output_block.data() + size_t(channel_index) * hop_length +
+                                        reducer_state.hop_fill_position;
+            for (int frame_index = 0; frame_index < exchange_length; frame_index++) {
+                history_slot[frame_index] = channel_plane[frame_index];
+                channel_plane[frame_index] = output_slot[frame_index];
+            }
+        }
+        reducer_state.hop_fill_position += exchange_length;
+        frame_position += exchange_length;
+
+        // The system processes a frame whenever a full hop has arrived and slides the history window
+        if (reducer_state.hop_fill_position == hop_length) {
+            process_noise_reduction_frame(reducer_state);
+            for (int channel_index = 0; channel_index < reducer_state.channel_count; channel_index++) {
+                double* input_history = reducer_state.input_history.data() + size_t(channel_index) * frame_length;
+                copy(input_history + hop_length, input_history + frame_length, input_history);
+            }
+            reducer_state.hop_fill_position = 0;
+        }
+    }
+}
+
+// Enumeration of deterministic test signals available for benchmarking and analyzer validation
+enum test_signal_type {
+    SIGNAL_LOG_SWEEP,                         // Exponential sine sweep between two frequencies
+    SIGNAL_MULTITONE,                         // Log-spaced, period-bin-aligned tones with seeded random phases
+    SIGNAL_IMPULSE_TRAIN,                     // Unit impulses at a fixed frame interval
+    SIGNAL_WHITE_NOISE,                       // Uniform white noise
+    SIGNAL_PINK_NOISE,                        // Noise with 3 dB per octave spectral slope
+    SIGNAL_BROWN_NOISE                        // Noise with 6 dB per octave spectral slope
+};
+
+// Structure definition for test signal parameters and variants
+struct test_signal_specification {
+    test_signal_type signal_type;             // Selected signal family
+    double amplitude;                         // Peak scale applied before variants
+    double start_frequency_hz;                // Sweep start or lowest multitone frequency
+    double end_frequency_hz;                  // Sweep end or highest multitone frequency
+    double sweep_duration_seconds;            // Duration of one sweep
+    int tone_count;                           // Number of multitone components
+    int impulse_interval_frames;              // Frames between impulses
+    double dc_offset;                         // Constant added to every sample
+    double clip_level;                        // Symmetric clipping ceiling (0 disables clipping)
+    uint64_t seed_value;                      // Seed for noise and multitone phases
+};
+
+// Multitone period length; tones are snapped to its bins so one period repeats seamlessly
+const int MULTITONE_PERIOD_FRAMES = 65536;
+
+// Structure definition for lane-parallel xoshiro256+ generator state in structure-of-arrays layout
+struct xoshiro_lane_generator {
+    uint64_t lane_state[4][SIMD_LANE_COUNT];  // Four state words for each independent lane
+};
+
+// Structure definition for streaming test signal generator state
+struct test_signal_generator_state {
+    test_signal_specification specification;  // Signal parameters
+    long long frame_position;                 // Frames generated so far
+    xoshiro_lane_generator noise_generator;   // Lane-parallel uniform source
+    vector<double> tone_frequencies;          // Multitone component frequencies
+    vector<double> tone_phases;               // Multitone component start phases
+    vector<double> multitone_period;          // One synthesized period of the bin-aligned multitone
+    vector<double> coloured_noise_state;      // Pink filter poles or brown integrator per channel
+};
+
+// Structure definition for a preallocated pool of equally sized planar blocks
+struct audio_block_pool {
+    vector<audio_processing_buffer> pooled_blocks; // Blocks allocated once at pool creation
+    vector<int> free_block_indices;           // Indices of blocks available for acquisition
+};
+
+// Function declaration for block pool creation with all storage allocated up front
+audio_block_pool create_audio_block_pool(int block_count, int channel_count, int frames_per_block) {
+    audio_block_pool block_pool;               // Local pool structure instance
+    block_pool.pooled_blocks.resize(block_count);
+    for (int block_index = 0; block_index < block_count; block_index++) {
+        block_pool.pooled_blocks[block_index].channel_count = channel_count;
+        block_pool.pooled_blocks[block_index].sample_data_array.assign(size_t(channel_count) * frames_per_block, 0.0);
+        block_pool.free_block_indices.push_back(block_count - 1 - block_index);
+    }
+    return block_pool;                         // Function returns populated pool
+}
+
+// Function declaration for pooled block acquisition
+audio_processing_buffer* acquire_pooled_block(audio_block_pool& block_pool) {
+    // The system hands out the most recently released block while any remain
+    if (block_pool.free_block_indices.empty()) {
+        return nullptr;
+    }
+    int block_index = block_pool.free_block_indices.back();
+    block_pool.free_block_indices.pop_back();
+    return &block_pool.pooled_blocks[block_index];
+}
+
+// Function declaration for pooled block release
+void release_pooled_block(audio_block_pool& block_pool, audio_processing_buffer* pooled_block) {
+    // The system returns the block to the free list by its position in the pool
+    block_pool.free_block_indices.push_back(int(pooled_block - block_pool.pooled_blocks.data()));
+}
+
+// Function declaration for splitmix64 seed expansion
+uint64_t splitmix_next(uint64_t& seed_state) {
+    // The system advances and scrambles the seed to derive well-mixed state words
+    uint64_t mixed_value = (seed_state += 0x9E3779B97F4A7C15ULL);
+    mixed_value = (mixed_value ^ (mixed_value >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    mixed_value = (mixed_value ^ (mixed_value >> 27)) * 0x94D049BB133111EBULL;
+    return mixed_value ^ (mixed_value >> 31);
+}
+
+// Function declaration for lane-parallel xoshiro256+ seeding
+xoshiro_lane_generator seed_xoshiro_lanes(uint64_t seed_value) {
+    xoshiro_lane_generator lane_generator;     // Local generator structure instance
+    uint64_t seed_state = seed_value;
+    for (int lane_index = 0; lane_index < SIMD_LANE_COUNT; lane_index++) {
+        for (int word_index = 0; word_index < 4; word_index++) {
+            lane_generator.lane_state[word_index][lane_index] = splitmix_next(seed_state);
+        }
+    }
+    return lane_generator;                     // Function returns seeded generator
+}
+
+// Function declaration for lane-parallel uniform generation in [-1, 1)
+void fill_uniform_samples(xoshiro_lane_generator& lane_generator, double* sample_data, int sample_count) {
+    // The system advances all lanes together so each state update maps onto vector shifts and xors
+    for (int sample_start = 0; sample_start < sample_count; sample_start += SIMD_LANE_COUNT) {
+        double lane_output[SIMD_LANE_COUNT];
+        for (int lane_index = 0; lane_index < SIMD_LANE_COUNT; lane_index++) {
+            uint64_t* s0 = &lane_generator.lane_state[0][lane_index];
+            uint64_t* s1 = &lane_generator.lane_state[1][lane_index];
+            uint64_t* s2 = &lane_generator.lane_state[2][lane_index];
+            uint64_t* s3 = &lane_generator.lane_state[3][lane_index];
+            uint64_t random_bits = *s0 + *s3;
+            uint64_t shifted_word = *s1 << 17;
+            *s2 ^= *s0; *s3 ^= *s1; *s1 ^= *s2; *s0 ^= *s3;
+            *s2 ^= shifted_word;
+            *s3 = (*s3 << 45) | (*s3 >> 19);
+            lane_output[lane_index] = double(int64_t(random_bits) >> 11) * 0x1.0p-52;
+        }
+        int copy_count = min(SIMD_LANE_COUNT, sample_count - sample_start);
+        copy(lane_output, lane_output + copy_count, sample_data + sample_start);
+    }
+}
+
+// Structure definition for a constant offset stage in the fused chain family
+struct offset_stage : fused_stage_marker {
+    double offset_value = 0.0;                // Constant added to every sample
+
+    double process_sample(double sample_value) { return sample_value + offset_value; }
+    void finish_block() {}
+};
+
+// Function declaration for test signal generator initialization
+test_signal_generator_state initialize_test_signal_generator(const test_signal_specification& specification, int channel_count) {
+    test_signal_generator_state generator_state; // Local state structure instance
+    generator_state.specification = specification;
+    generator_state.frame_position = 0;
+    generator_state.noise_generator = seed_xoshiro_lanes(specification.seed_value);
+
+    // The system spaces multitone components logarithmically, snaps each to a distinct period bin and draws its phase from the seed
+    uint64_t phase_seed = specification.seed_value ^ 0xA5A5A5A5A5A5A5A5ULL;
+    int previous_bin = 0;
+    for (int tone_index = 0; tone_index < specification.tone_count; tone_index++) {
+        double tone_position = specification.tone_count > 1 ? double(tone_index) / (specification.tone_count - 1) : 0.0;
+        double requested_frequency = specification.start_frequency_hz *
+            pow(specification.end_frequency_hz / specification.start_frequency_hz, tone_position);
+        int tone_bin = max(previous_bin + 1, int(lround(requested_frequency * MULTITONE_PERIOD_FRAMES / SAMPLE_RATE)));
+        if (tone_bin >= MULTITONE_PERIOD_FRAMES / 2) {
+            break;
+        }
+        previous_bin = tone_bin;
+        generator_state.tone_frequencies.push_back(tone_bin * SAMPLE_RATE / MULTITONE_PERIOD_FRAMES);
+        generator_state.tone_phases.push_back(2.0 * M_PI * double(splitmix_next(phase_seed) >> 11) * 0x1.0p-53);
+    }
+
+    // The system synthesizes one period with a single inverse transform of a conjugate-symmetric line spectrum
+    if (specification.signal_type == SIGNAL_MULTITONE && !generator_state.tone_frequencies.empty()) {
+        vector<double> spectrum_real(MULTITONE_PERIOD_FRAMES, 0.0);
+        vector<double> spectrum_imag(MULTITONE_PERIOD_FRAMES, 0.0);
+        double line_magnitude = 0.5 * MULTITONE_PERIOD_FRAMES * specification.amplitude / max(1, specification.tone_count);
+        for (size_t tone_index = 0; tone_index < generator_state.tone_frequencies.size(); tone_index++) {
+            int tone_bin = int(lround(generator_state.tone_frequencies[tone_index] * MULTITONE_PERIOD_FRAMES / SAMPLE_RATE));
+            double line_phase = generator_state.tone_phases[tone_index] - 0.5 * M_PI;
+            spectrum_real[tone_bin] = line_magnitude * cos(line_phase);
+            spectrum_imag[tone_bin] = line_magnitude * sin(line_phase);
+            spectrum_real[MULTITONE_PERIOD_FRAMES - tone_bin] = spectrum_real[tone_bin];
+            spectrum_imag[MULTITONE_PERIOD_FRAMES - tone_bin] = -spectrum_imag[tone_bin];
+        }
+        execute_fft(acquire_fft_plan(MULTITONE_PERIOD_FRAMES), spectrum_real.data(), spectrum_imag.data(), true);
+        generator_state.multitone_period = move(spectrum_real);
+    }
+    generator_state.coloured_noise_state.assign(size_t(channel_count) * 7, 0.0);
+
+    return generator_state;                    // Function returns prepared generator state
+}
+
+// Function declaration for deterministic test signal generation directly into a planar block
+void generate_test_signal_block(test_signal_generator_state& generator_state, audio_processing_buffer& target_block) {
+    const test_signal_specification& specification = generator_state.specification;
+    int frame_total = frames_per_channel(target_block);
+    long long first_frame = generator_state.frame_position;
+
+    for (int channel_index = 0; channel_index < target_block.channel_count; channel_index++) {
+        double* channel_plane = access_channel_plane(target_block, channel_index);
+
+        // The system copies the finished first plane for deterministic signals, which are identical on every channel
+        bool deterministic_signal = specification.signal_type == SIGNAL_LOG_SWEEP ||
+                                    specification.signal_type == SIGNAL_MULTITONE ||
+                                    specification.signal_type == SIGNAL_IMPULSE_TRAIN;
+        if (deterministic_signal && channel_index > 0) {
+            const double* first_plane = access_channel_plane(target_block, 0);
+            copy(first_plane, first_plane + frame_total, channel_plane);
+            continue;
+        }
+
+        switch (specification.signal_type) {
+            case SIGNAL_LOG_SWEEP: {
+                // The system splits the block at sweep restarts and seeds each lane's exponential in closed form
+                double sweep_frames = specification.sweep_duration_seconds * SAMPLE_RATE;
+                double log_ratio = log(specification.end_frequency_hz / specification.start_frequency_hz);
+                double phase_scale = 2.0 * M_PI * specification.start_frequency_hz * specification.sweep_duration_seconds / log_ratio;
+                double group_growth = exp(SIMD_LANE_COUNT * log_ratio / sweep_frames);
+                int segment_start = 0;
+                while (segment_start < frame_total) {
+                    double cycle_position = fmod(double(first_frame + segment_start), sweep_frames);
+                    int segment_length = max(1, min(frame_total - segment_start, int(ceil(sweep_frames - cycle_position))));
+                    double lane_growth[SIMD_LANE_COUNT];
+                    for (int lane_index = 0; lane_index < SIMD_LANE_COUNT; lane_index++) {
+                        lane_growth[lane_index] = exp((cycle_position + lane_index) / sweep_frames * log_ratio);
+                    }
+
+                    // The system advances every lane's exponential by one multiply per group and evaluates the sine without library calls
+                    for (int group_start = 0; group_start < segment_length; group_start += SIMD_LANE_COUNT) {
+                        double lane_output[SIMD_LANE_COUNT];
+                        for (int lane_index = 0; lane_index < SIMD_LANE_COUNT; lane_index++) {
+                            lane_output[lane_index] = specification.amplitude *
+                                                      approximate_sin(phase_scale * (lane_growth[lane_index] - 1.0));
+                            lane_growth[lane_index] *= group_growth;
+                        }
+                        int lane_total = min(SIMD_LANE_COUNT, segment_length - group_start);
+                        copy(lane_output, lane_output + lane_total, channel_plane + segment_start + group_start);
+                    }
+                    segment_start += segment_length;
+                }
+                break;
+            }
+            case SIGNAL_MULTITONE: {
+                // The system streams the precomputed period with wrap-around, so each sample is a single copy
+                const vector<double>& period_samples = generator_state.multitone_period;
+                if (period_samples.empty()) {
+                    fill(channel_plane, channel_plane + frame_total, 0.0);
+                    break;
+                }
+                int period_position = int(first_frame % MULTITONE_PERIOD_FRAMES);
+                int frame_position = 0;
+                while (frame_position < frame_total) {
+                    int copy_length = min(frame_total - frame_position, MULTITONE_PERIOD_FRAMES - period_position);
+                    copy(period_samples.begin() + period_position, period_samples.begin() + period_position + copy_length,
+                         channel_plane + frame_position);
+                    frame_position += copy_length;
+                    period_position = 0;
+                }
+                break;
+            }
+            case SIGNAL_IMPULSE_TRAIN: {
+                // The system writes impulses only at interval boundaries
+                fill(channel_plane, channel_plane + frame_total, 0.0);
+                long long interval = max(1, specification.impulse_interval_frames);
+                long long first_impulse = (first_frame + interval - 1) / interval * interval;
+                for (long long impulse_frame = first_impulse; impulse_frame < first_frame + frame_total; impulse_frame += interval) {
+                    channel_plane[impulse_frame - first_frame] = specification.amplitude;
+                }
+                break;
+            }
+            case SIGNAL_WHITE_NOISE:
+            case SIGNAL_PINK_NOISE:
+            case SIGNAL_BROWN_NOISE: {
+                // The system fills the plane with uniform noise straight from the lane generators
+                fill_uniform_samples(generator_state.noise_generator, channel_plane, frame_total);
+                double* noise_state = generator_state.coloured_noise_state.data() + size_t(channel_index) * 7;
+                if (specification.signal_type == SIGNAL_PINK_NOISE) {
+                    // The system shapes white noise with the refined Kellet parallel pole network
+                    for (int frame_index = 0; frame_index < frame_total; frame_index++) {
+                        double white_value = channel_plane[frame_index];
+                        noise_state[0] = 0.99886 * noise_state[0] + white_value * 0.0555179;
+                        noise_state[1] = 0.99332 * noise_state[1] + white_value * 0.0750759;
+                        noise_state[2] = 0.96900 * noise_state[2] + white_value * 0.1538520;
+                        noise_state[3] = 0.86650 * noise_state[3] + white_value * 0.3104856;
+                        noise_state[4] = 0.55000 * noise_state[4] + white_value * 0.5329522;
+                        noise_state[5] = -0.7616 * noise_state[5] - white_value * 0.0168980;
+                        double pink_value = noise_state[0] + noise_state[1] + noise_state[2] + noise_state[3] +
+                                            noise_state[4] + noise_state[5] + noise_state[6] + white_value * 0.5362;
+                        noise_state[6] = white_value * 0.115926;
+                        channel_plane[frame_index] = 0.11 * pink_value;
+                    }
+                } else if (specification.signal_type == SIGNAL_BROWN_NOISE) {
+                    // The system integrates white noise with a slight leak to keep the level bounded
+                    for (int frame_index = 0; frame_index < frame_total; frame_index++) {
+                        noise_state[0] = 0.998 * noise_state[0] + 0.05 * channel_plane[frame_index];
+                        channel_plane[frame_index] = noise_state[0];
+                    }
+                }
+                for (int frame_index = 0; frame_index < frame_total; frame_index++) {
+                    channel_plane[frame_index] *= specification.amplitude;
+                }
+                break;
+            }
+        }
+
+        // The system applies DC-offset and clipping variants in one fused pass
+        offset_stage dc_variant;
+        hard_clip_stage clip_variant;
+        dc_variant.offset_value = specification.dc_offset;
+        clip_variant.ceiling_level = specification.clip_level > 0.0 ? specification.clip_level : HUGE_VAL;
+        auto variant_chain = dc_variant | clip_variant;
+        run_fused_chain(variant_chain, channel_plane, frame_total);
+    }
+
+    generator_state.frame_position += frame_total;
+}
+
+// Structure definition for a sliding mono frame assembled one hop at a time
+struct mono_hop_history {
+    vector<double> history_samples;           // Current frame plus slack, so hops slide without shifting
+    int window_start;                         // Position of the oldest sample of the current frame
+    int hop_fill_position;                    // Frames received into the current hop
+    int frame_length;                         // Frames handed to each analysis
+    int hop_length;                           // Frames between successive analyses
+};
+
+// Function declaration for mono hop history initialization with a silent first frame
+mono_hop_history initialize_mono_hop_history(int frame_length, int hop_length) {
+    mono_hop_history hop_history;              // Local history structure instance
+    hop_history.frame_length = frame_length;
+    hop_history.hop_length = max(1, min(hop_length, frame_length));
+    hop_history.history_samples.assign(2 * size_t(frame_length), 0.0);
+    hop_history.window_start = 0;
+    hop_history.hop_fill_position = 0;
+    return hop_history;                        // Function returns empty history
+}
+
+// Function declaration for the current analysis frame, oldest sample first
+inline const double* current_mono_frame(const mono_hop_history& hop_history) {
+    return hop_history.history_samples.data() + hop_history.window_start;
+}
+
+// Template function declaration for streaming the mono downmix of one planar block into hop-sized frames
+template <typename frame_callback>
+void stream_mono_hops(mono_hop_history& hop_history, const audio_processing_buffer& source_buffer, frame_callback on_frame) {
+    int frame_total = frames_per_channel(source_buffer);
+    int frame_length = hop_history.frame_length;
+    int hop_length = hop_history.hop_length;
+    int history_capacity = int(hop_history.history_samples.size());
+    double downmix_scale = 1.0 / max(1, source_buffer.channel_count);
+    int frame_position = 0;
+
+    // Iterative loop appends the mono downmix one hop at a time and hands each completed frame to the analyser
+    while (frame_position < frame_total) {
+        int exchange_length = min(hop_length - hop_history.hop_fill_position, frame_total - frame_position);
+        double* history_slot = hop_history.history_samples.data() + hop_history.window_start + (frame_length - hop_length) +
+                               hop_history.hop_fill_position;
+        fill(history_slot, history_slot + exchange_length, 0.0);
+        for (int channel_index = 0; channel_index < source_buffer.channel_count; channel_index++) {
+            const double* channel_plane = access_channel_plane(source_buffer, channel_index) + frame_position;
+            for (int frame_index = 0; frame_index < exchange_length; frame_index++) {
+                history_slot[frame_index] += downmix_scale * channel_plane[frame_index];
+            }
+        }
+        hop_history.hop_fill_position += exchange_length;
+        frame_position += exchange_length;
+
+        if (hop_history.hop_fill_position == hop_length) {
+            on_frame(current_mono_frame(hop_history));
+            hop_history.hop_fill_position = 0;
+
+            // The system slides the window and moves the retained overlap back only when the slack runs out,
+            // so each hop costs O(hop) amortised rather than O(frame)
+            hop_history.window_start += hop_length;
+            if (hop_history.window_start + frame_length > history_capacity) {
+                double* history_data = hop_history.history_samples.data();
+                copy(history_data + hop_history.window_start, history_data + hop_history.window_start + (frame_length - hop_length),
+                     history_data);
+                hop_history.window_start = 0;
+            }
+        }
+    }
+}
+
+// Enumeration of novelty functions supported by the onset detector
+enum onset_detection_function {
+    ONSET_SPECTRAL_FLUX,                      // Half-wave rectified rise in log-compressed magnitude
+    ONSET_COMPLEX_DOMAIN                      // Rectified deviation from the phase-predicted spectrum
+};
+
+// Structure definition for onset detector configuration parameters
+struct onset_detector_configuration {
+    onset_detection_function detection_function; // Selected novelty function
+    int hop_length;                           // Frames between successive analysis frames
+    int median_window_frames;                 // Odd length of the adaptive threshold window
+    double threshold_offset;                  // Constant added to the scaled median
+    double threshold_multiplier;              // Scale applied to the sliding median
+    double minimum_interval_seconds;          // Shortest allowed spacing between onsets
+};
+
+// Structure definition for a sliding median held in two balanced ordered halves
+struct sliding_median_window {
+    multiset<double> lower_half;              // Smaller values, largest element is the median
+    multiset<double> upper_half;              // Larger values
+    vector<double> arrival_ring;              // Values in arrival order for expiry
+    int ring_position;                        // Oldest entry position once the ring is full
+    int stored_count;                         // Entries currently held
+};
+
+// Structure definition for streaming onset detector state
+struct onset_detector_state {
+    onset_detector_configuration configuration; // Detector parameters
+    int frame_length;                         // STFT frame length (uses the baked Hann window)
+    int spectrum_bins;                        // Non-redundant bins per frame
+    const fft_transform_plan* transform_plan; // Shared plan for the frame length
+    mono_hop_history hop_history;             // Sliding frame of mono downmix
+    vector<double> previous_magnitude;        // Previous frame magnitude, overwritten bin by bin
+    vector<double> previous_phase;            // Previous frame phase, overwritten bin by bin
+    vector<double> previous_phase_advance;    // Previous per-bin phase advance for prediction
+    vector<double> transform_real;            // Transform scratch, real parts
+    vector<double> transform_imag;            // Transform scratch, imaginary parts
+    sliding_median_window threshold_window;   // Median over recent novelty values
+    vector<double> novelty_history;           // Recent novelty values in a ring
+    int novelty_head;                         // Ring position of the oldest novelty value
+    bool envelope_recording_enabled;          // Whether every novelty value is kept for tempo analysis
+    vector<double> novelty_envelope;          // Full novelty envelope when recording is enabled
+    long long analysed_frame_count;           // Novelty values produced so far
+    double last_onset_time;                   // Time of the most recent reported onset
+    vector<double> onset_times;               // Reported onset timestamps in seconds
+};
+
+// Function declaration for sliding median window initialization
+sliding_median_window initialize_sliding_median(int window_length) {
+    sliding_median_window median_window;       // Local window structure instance
+    median_window.arrival_ring.assign(window_length, 0.0);
+    median_window.ring_position = 0;
+    median_window.stored_count = 0;
+    return median_window;                      // Function returns empty window
+}
+
+// Function declaration for sliding median half rebalancing
+void rebalance_sliding_median(sliding_median_window& median_window) {
+    // The system keeps the lower half equal to or one larger than the upper half
+    if (median_window.lower_half.size() > median_window.upper_half.size() + 1) {
+        auto largest_lower = prev(median_window.lower_half.end());
+        median_window.upper_half.insert(*largest_lower);
+        median_window.lower_half.erase(largest_lower);
+    } else if (median_window.upper_half.size() > median_window.lower_half.size()) {
+        auto smallest_upper = median_window.upper_half.begin();
+        median_window.lower_half.insert(*smallest_upper);
+        median_window.upper_half.erase(smallest_upper);
+    }
+}
+
+// Function declaration for sliding median update in logarithmic time
+double push_sliding_median(sliding_median_window& median_window, double new_value) {
+    int window_length = int(median_window.arrival_ring.size());
+
+    // The system expires the oldest value from whichever half holds it
+    if (median_window.stored_count == window_length) {
+        double expired_value = median_window.arrival_ring[median_window.ring_position];
+        auto lower_match = median_window.lower_half.find(expired_value);
+        if (lower_match != median_window.lower_half.end()) {
+            median_window.lower_half.erase(lower_match);
+        } else {
+            median_window.upper_half.erase(median_window.upper_half.find(expired_value));
+        }
+    } else {
+        median_window.stored_count++;
+    }
+    median_window.arrival_ring[median_window.ring_position] = new_value;
+    median_window.ring_position = (median_window.ring_position + 1) % window_length;
+
+    // The system inserts on the correct side and restores the balance with at most one move
+    if (median_window.lower_half.empty() || new_value <= *median_window.lower_half.rbegin()) {
+        median_window.lower_half.insert(new_value);
+    } else {
+        median_window.upper_half.insert(new_value);
+    }
+    rebalance_sliding_median(median_window);
+    rebalance_sliding_median(median_window);
+
+    return *median_window.lower_half.rbegin(); // Function returns the current median
+}
+
+// Function declaration for onset detector initialization
+onset_detector_state initialize_onset_detector(const onset_detector_configuration& configuration) {
+    onset_detector_state detector_state;       // Local state structure instance
+    detector_state.configuration = configuration;
+    detector_state.frame_length = AUDIO_BUFFER_SIZE;
+    detector_state.spectrum_bins = AUDIO_BUFFER_SIZE / 2 + 1;
+    detector_state.transform_plan = &acquire_fft_plan(AUDIO_BUFFER_SIZE);
+    detector_state.hop_history = initialize_mono_hop_history(AUDIO_BUFFER_SIZE, configuration.hop_length);
+    detector_state.previous_magnitude.assign(detector_state.spectrum_bins, 0.0);
+    detector_state.previous_phase.assign(detector_state.spectrum_bins, 0.0);
+    detector_state.previous_phase_advance.assign(detector_state.spectrum_bins, 0.0);
+    detector_state.transform_real.assign(AUDIO_BUFFER_SIZE, 0.0);
+    detector_state.transform_imag.assign(AUDIO_BUFFER_SIZE, 0.0);
+    detector_state.threshold_window = initialize_sliding_median(configuration.median_window_frames | 1);
+    detector_state.novelty_history.assign(configuration.median_window_frames | 1, 0.0);
+    detector_state.novelty_head = 0;
+    detector_state.envelope_recording_enabled = false;
+    detector_state.analysed_frame_count = 0;
+    detector_state.last_onset_time = -1e9;
+    return detector_state;                     // Function returns prepared detector state
+}
+
+// Function declaration for novelty evaluation of one frame against the spectrum stored in place
+double compute_onset_novelty(onset_detector_state& detector_state, const double* frame_samples) {
+    int frame_length = detector_state.frame_length;
+    double* transform_real = detector_state.transform_real.data();
+    double* transform_imag = detector_state.transform_imag.data();
+    for (int sample_index = 0; sample_index < frame_length; sample_index++) {
+        transform_real[sample_index] = frame_samples[sample_index] * HANN_WINDOW_TABLE[sample_index];
+        transform_imag[sample_index] = 0.0;
+    }
+    execute_fft(*detector_state.transform_plan, transform_real, transform_imag, false);
+
+    // The system compares each bin with the previous frame and overwrites that entry in the same pass
+    double novelty_value = 0.0;
+    bool complex_domain = (detector_state.configuration.detection_function == ONSET_COMPLEX_DOMAIN);
+    for (int bin_index = 0; bin_index < detector_state.spectrum_bins; bin_index++) {
+        double bin_magnitude = sqrt(transform_real[bin_index] * transform_real[bin_index] +
+                                    transform_imag[bin_index] * transform_imag[bin_index]);
+        double& previous_magnitude = detector_state.previous_magnitude[bin_index];
+        if (complex_domain) {
+            double bin_phase = atan2(transform_imag[bin_index], transform_real[bin_index]);
+            double& previous_phase = detector_state.previous_phase[bin_index];
+            double& previous_advance = detector_state.previous_phase_advance[bin_index];
+            if (bin_magnitude >= previous_magnitude) {
+                double phase_error = bin_phase - (previous_phase + previous_advance);
+                novelty_value += sqrt(max(0.0, bin_magnitude * bin_magnitude + previous_magnitude * previous_magnitude -
+                                               2.0 * bin_magnitude * previous_magnitude * cos(phase_error)));
+            }
+            previous_advance = bin_phase - previous_phase;
+            previous_phase = bin_phase;
+            previous_magnitude = bin_magnitude;
+        } else {
+            double compressed_magnitude = log1p(bin_magnitude);
+            novelty_value += max(0.0, compressed_magnitude - previous_magnitude);
+            previous_magnitude = compressed_magnitude;
+        }
+    }
+    return novelty_value / detector_state.spectrum_bins; // Function returns the frame novelty
+}
+
+// Function declaration for adaptive peak picking on the newest novelty value
+void pick_onset_peak(onset_detector_state& detector_state, double novelty_value) {
+    const onset_detector_configuration& configuration = detector_state.configuration;
+    vector<double>& novelty_history = detector_state.novelty_history;
+    int window_length = int(novelty_history.size());
+    int centre_offset = window_length / 2;
+
+    // The system delays decisions by half a window so the median is centred on the candidate, overwriting the
+    // oldest ring entry so each frame costs only the logarithmic median update
+    novelty_history[detector_state.novelty_head] = novelty_value;
+    detector_state.novelty_head = (detector_state.novelty_head + 1) % window_length;
+    auto novelty_at = [&](int age_index) {
+        return novelty_history[(detector_state.novelty_head + age_index) % window_length];
+    };
+    double window_median = push_sliding_median(detector_state.threshold_window, novelty_value);
+    long long candidate_frame = detector_state.analysed_frame_count - centre_offset;
+    detector_state.analysed_frame_count++;
+    if (candidate_frame < 1) {
+        return;
+    }
+
+    double candidate_value = novelty_at(centre_offset);
+    double adaptive_threshold = configuration.threshold_offset + configuration.threshold_multiplier * window_median;
+    bool local_maximum = candidate_value >= novelty_at(centre_offset - 1) && candidate_value > novelty_at(centre_offset + 1);
+    double candidate_time = double((candidate_frame + 1) * configuration.hop_length - detector_state.frame_length / 2) / SAMPLE_RATE;
+    if (local_maximum && candidate_value > adaptive_threshold &&
+        candidate_time - detector_state.last_onset_time >= configuration.minimum_interval_seconds) {
+        detector_state.onset_times.push_back(candidate_time);
+        detector_state.last_onset_time = candidate_time;
+    }
+}
+
+// Function declaration for streaming onset detection over one planar block
+void feed_onset_detector(onset_detector_state& detector_state, const audio_processing_buffer& source_buffer) {
+    // The system analyses each completed frame as soon as its hop arrives
+    stream_mono_hops(detector_state.hop_history, source_buffer, [&](const double* frame_samples) {
+        double novelty_value = compute_onset_novelty(detector_state, frame_samples);
+        if (detector_state.envelope_recording_enabled) {
+            detector_state.novelty_envelope.push_back(novelty_value);
+        }
+        pick_onset_peak(detector_state, novelty_value);
+    });
+}
+
+// Function declaration for flushing candidates still waiting on look-ahead frames
+void finalize_onset_detection(onset_detector_state& detector_state) {
+    int pending_frames = int(detector_state.novelty_history.size()) / 2;
+    for (int frame_index = 0; frame_index < pending_frames; frame_index++) {
+        pick_onset_peak(detector_state, 0.0);
+    }
+}
+
+// Structure definition for per-file tempo and beat tracking results
+struct tempo_analysis_report {
+    double tempo_bpm;                         // Dominant tempo in beats per minute
+    double tempo_confidence;                  // Normalised autocorrelation strength at the chosen period
+    vector<double> beat_times;                // Beat timestamps in seconds
+};
+
+// Function declaration for tempo estimation and dynamic-programming beat tracking on a novelty envelope
+tempo_analysis_report track_tempo_and_beats(const vector<double>& novelty_envelope, double envelope_frame_rate,
+                                            double envelope_time_offset, double minimum_bpm = 60.0, double maximum_bpm = 200.0) {
+    tempo_analysis_report tempo_report;        // Local report structure instance
+    tempo_report.tempo_bpm = 0.0;
+    tempo_report.tempo_confidence = 0.0;
+    int envelope_length = int(novelty_envelope.size());
+    int minimum_lag = max(1, int(envelope_frame_rate * 60.0 / maximum_bpm));
+    int maximum_lag = int(ceil(envelope_frame_rate * 60.0 / minimum_bpm));
+    if (envelope_length < 4 * maximum_lag) {
+        return tempo_report;
+    }
+
+    // The system removes the mean and scales to unit deviation so scores are level independent
+    double envelope_mean = accumulate(novelty_envelope.begin(), novelty_envelope.end(), 0.0) / envelope_length;
+    double envelope_variance = 0.0;
+    for (double envelope_value : novelty_envelope) {
+        envelope_variance += (envelope_value - envelope_mean) * (envelope_value - envelope_mean);
+    }
+    double envelope_scale = 1.0 / sqrt(max(envelope_variance / envelope_length, 1e-24));
+    vector<double> normalised_envelope(envelope_length);
+    for (int frame_index = 0; frame_index < envelope_length; frame_index++) {
+        normalised_envelope[frame_index] = (novelty_envelope[frame_index] - envelope_mean) * envelope_scale;
+    }
+
+    // The system accumulates short-lag autocorrelation blockwise, packing each block (real part) and its two-block
+    // continuation (imaginary part) into one forward transform; the block covers every comb lag, so slow tempi or
+    // fine envelope hops move to a larger planned transform while the default range keeps the baked 2048-point one
+    int correlation_block = AUDIO_BUFFER_SIZE;
+    while (correlation_block < 4 * (maximum_lag + 1) + 2) {
+        correlation_block *= 2;
+    }
+    const int transform_size = 2 * correlation_block;
+    const fft_transform_plan& transform_plan = acquire_fft_plan(transform_size);
+    vector<double> spectrum_sum_real(transform_size, 0.0);
+    vector<double> spectrum_sum_imag(transform_size, 0.0);
+    vector<double> correlation_real(transform_size);
+    vector<double> correlation_imag(transform_size);
+    for (int block_start = 0; block_start < envelope_length; block_start += correlation_block) {
+        for (int point_index = 0; point_index < transform_size; point_index++) {
+            int source_index = block_start + point_index;
+            double source_value = source_index < envelope_length ? normalised_envelope[source_index] : 0.0;
+            correlation_real[point_index] = point_index < correlation_block ? source_value : 0.0;
+            correlation_imag[point_index] = source_value;
+        }
+        execute_fft(transform_plan, correlation_real.data(), correlation_imag.data(), false);
+        for (int bin_index = 0; bin_index < transform_size; bin_index++) {
+            int mirror_index = (transform_size - bin_index) & (transform_size - 1);
+            double block_re = 0.5 * (correlation_real[bin_index] + correlation_real[mirror_index]);
+            double block_im = 0.5 * (correlation_imag[bin_index] - correlation_imag[mirror_index]);
+            double span_re = 0.5 * (correlation_imag[bin_index] + correlation_imag[mirror_index]);
+            double span_im = -0.5 * (correlation_real[bin_index] - correlation_real[mirror_index]);
+            spectrum_sum_real[bin_index] += block_re * span_re + block_im * span_im;
+            spectrum_sum_imag[bin_index] += block_re * span_im - block_im * span_re;
+        }
+    }
+    correlation_real = spectrum_sum_real;
+    correlation_imag = spectrum_sum_imag;
+    execute_fft(transform_plan, correlation_real.data(), correlation_imag.data(), true);
+
+    // The system scores each lag as a comb over its first multiples, weighted by a log-Gaussian prior around 120 BPM
+    auto unbiased_correlation = [&](int lag_value) {
+        return correlation_real[lag_value] / (correlation_real[0] * double(envelope_length - lag_value) / envelope_length);
+    };
+    int best_lag = minimum_lag;
+    double best_score = -1e300;
+    vector<double> lag_scores(maximum_lag + 2, 0.0);
+    for (int lag_value = minimum_lag - 1; lag_value <= maximum_lag + 1; lag_value++) {
+        double comb_sum = 0.0;
+        double comb_weight = 0.0;
+        for (int multiple_index = 1; multiple_index <= 4 && multiple_index * lag_value < envelope_length / 2; multiple_index++) {
+            comb_sum += unbiased_correlation(multiple_index * lag_value) / multiple_index;
+            comb_weight += 1.0 / multiple_index;
+        }
+        double lag_bpm = 60.0 * envelope_frame_rate / lag_value;
+        double octave_distance = log2(lag_bpm / 120.0);
+        lag_scores[lag_value] = comb_sum / max(comb_weight, 1e-12) * exp(-0.5 * octave_distance * octave_distance);
+        if (lag_value >= minimum_lag && lag_value <= maximum_lag && lag_scores[lag_value] > best_score) {
+            best_score = lag_scores[lag_value];
+            best_lag = lag_value;
+        }
+    }
+
+    // The system refines the period on the highest available multiple, where one lag step is a fraction of a period
+    int refine_multiple = 1;
+    while (refine_multiple < 8 && (refine_multiple * 2) * (best_lag + 1) < min(envelope_length / 2, correlation_block - 1)) {
+        refine_multiple *= 2;
+    }
+    int refine_peak = refine_multiple * best_lag;
+    for (int lag_value = refine_multiple * (best_lag - 1) + 1; lag_value < refine_multiple * (best_lag + 1); lag_value++) {
+        if (correlation_real[lag_value] > correlation_real[refine_peak]) {
+            refine_peak = lag_value;
+        }
+    }
+    double left_value = correlation_real[refine_peak - 1];
+    double centre_value = correlation_real[refine_peak];
+    double right_value = correlation_real[refine_peak + 1];
+    double curvature = left_value - 2.0 * centre_value + right_value;
+    double period_frames = (refine_peak + (curvature < 0.0 ? 0.5 * (left_value - right_value) / curvature : 0.0)) / refine_multiple;
+    tempo_report.tempo_bpm = 60.0 * envelope_frame_rate / period_frames;
+    tempo_report.tempo_confidence = max(0.0, unbiased_correlation(best_lag));
+
+    // The system accumulates the best beat path score with a log-squared penalty on deviation from the period
+    const double tightness_weight = 100.0;
+    int search_start = max(1, int(period_frames / 2.0));
+    int search_end = int(2.0 * period_frames);
+    vector<double> transition_penalty(search_end + 1, 0.0);
+    for (int offset_value = search_start; offset_value <= search_end; offset_value++) {
+        double log_ratio = log(offset_value / period_frames);
+        transition_penalty[offset_value] = -tightness_weight * log_ratio * log_ratio;
+    }
+    vector<double> path_score(envelope_length);
+    vector<int> path_predecessor(envelope_length, -1);
+    for (int frame_index = 0; frame_index < envelope_length; frame_index++) {
+        double best_previous = 0.0;
+        int best_predecessor = -1;
+        for (int offset_value = search_start; offset_value <= min(search_end, frame_index); offset_value++) {
+            double candidate_score = path_score[frame_index - offset_value] + transition_penalty[offset_value];
+            if (candidate_score > best_previous) {
+                best_previous = candidate_score;
+                best_predecessor = frame_index - offset_value;
+            }
+        }
+        path_score[frame_index] = max(0.0, normalised_envelope[frame_index]) + best_previous;
+        path_predecessor[frame_index] = best_predecessor;
+    }
+
+    // The system backtracks from the strongest frame in the final period
+    int final_frame = envelope_length - 1;
+    for (int frame_index = max(0, envelope_length - int(period_frames)); frame_index < envelope_length; frame_index++) {
+        if (path_score[frame_index] > path_score[final_frame]) {
+            final_frame = frame_index;
+        }
+    }
+    for (int frame_index = final_frame; frame_index >= 0; frame_index = path_predecessor[frame_index]) {
+        tempo_report.beat_times.push_back(frame_index / envelope_frame_rate + envelope_time_offset);
+    }
+    reverse(tempo_report.beat_times.begin(), tempo_report.beat_times.end());
+
+    return tempo_report;                       // Function returns tempo and beat results
+}
+
+// Number of candidate thresholds in the probabilistic YIN threshold prior
+const int PYIN_THRESHOLD_COUNT = 100;
+
+// Structure definition for pitch tracker configuration parameters
+struct pitch_tracker_configuration {
+    double minimum_frequency_hz;              // Lowest fundamental searched
+    double maximum_frequency_hz;              // Highest fundamental searched
+    int hop_length;                           // Frames between successive estimates
+    double absolute_threshold;                // YIN dip threshold on the normalised difference
+    bool probabilistic_voicing;               // Integrate over a Beta threshold prior (pYIN first stage)
+};
+
+// Structure definition for one point of the pitch contour
+struct pitch_frame_estimate {
+    double frame_time;                        // Centre of the analysis frame in seconds
+    double frequency_hz;                      // Estimated fundamental (0 when unvoiced)
+    double voicing_confidence;                // Voicing probability or one minus the dip depth
+    bool voiced_frame;                        // Whether the frame is classified as voiced
+};
+
+// Structure definition for streaming pitch tracker state with fixed-size buffers only
+struct pitch_tracker_state {
+    pitch_tracker_configuration configuration; // Tracker parameters
+    int frame_length;                         // Analysis frame (twice the integration window)
+    int integration_window;                   // YIN integration window and maximum lag bound
+    int minimum_lag;                          // Shortest period searched in samples
+    int maximum_lag;                          // Longest period searched in samples
+    const fft_transform_plan* transform_plan; // Shared plan for the frame length
+    mono_hop_history hop_history;             // Sliding frame of mono downmix
+    long long analysed_frame_count;           // Frames analysed so far
+    vector<double> transform_real;            // Transform scratch, real parts
+    vector<double> transform_imag;            // Transform scratch, imaginary parts
+    vector<double> normalised_difference;     // Cumulative mean normalised difference per lag
+    vector<double> threshold_prior;           // Beta(2, 18) weights over candidate thresholds
+};
+
+// Function declaration for pitch tracker initialization
+pitch_tracker_state initialize_pitch_tracker(const pitch_tracker_configuration& configuration) {
+    pitch_tracker_state tracker_state;         // Local state structure instance
+    tracker_state.configuration = configuration;
+    tracker_state.frame_length = COMPILE_TIME_FFT_SIZE;
+    tracker_state.integration_window = COMPILE_TIME_FFT_SIZE / 2;
+    tracker_state.minimum_lag = max(2, int(SAMPLE_RATE / configuration.maximum_frequency_hz));
+    tracker_state.maximum_lag = min(tracker_state.integration_window - 2, int(ceil(SAMPLE_RATE / configuration.minimum_frequency_hz)));
+    tracker_state.transform_plan = &acquire_fft_plan(tracker_state.frame_length);
+    tracker_state.hop_history = initialize_mono_hop_history(tracker_state.frame_length, configuration.hop_length);
+    tracker_state.analysed_frame_count = 0;
+    tracker_state.transform_real.assign(tracker_state.frame_length, 0.0);
+    tracker_state.transform_imag.assign(tracker_state.frame_length, 0.0);
+    tracker_state.normalised_difference.assign(tracker_state.integration_window, 1.0);
+
+    // The system tabulates the threshold prior once so every frame only sums weights
+    double prior_total = 0.0;
+    tracker_state.threshold_prior.resize(PYIN_THRESHOLD_COUNT);
+    for (int threshold_index = 0; threshold_index < PYIN_THRESHOLD_COUNT; threshold_index++) {
+        double threshold_value = (threshold_index + 1.0) / PYIN_THRESHOLD_COUNT;
+        tracker_state.threshold_prior[threshold_index] = threshold_value * pow(1.0 - threshold_value, 17.0);
+        prior_total += tracker_state.threshold_prior[threshold_index];
+    }
+    for (double& prior_weight : tracker_state.threshold_prior) {
+        prior_weight /= prior_total;
+    }
+
+    return tracker_state;                      // Function returns prepared tracker state
+}
+
+// Function declaration for the YIN cumulative mean normalised difference through one packed transform pair
+void compute_normalised_difference(pitch_tracker_state& tracker_state, const double* frame_samples) {
+    int frame_length = tracker_state.frame_length;
+    int integration_window = tracker_state.integration_window;
+    double* transform_real = tracker_state.transform_real.data();
+    double* transform_imag = tracker_state.transform_imag.data();
+
+    // The system correlates the first window (real part) against the whole frame (imaginary part)
+    for (int sample_index = 0; sample_index < frame_length; sample_index++) {
+        transform_real[sample_index] = sample_index < integration_window ? frame_samples[sample_index] : 0.0;
+        transform_imag[sample_index] = frame_samples[sample_index];
+    }
+    execute_fft(*tracker_state.transform_plan, transform_real, transform_imag, false);
+    for (int bin_index = 0; bin_index <= frame_length / 2; bin_index++) {
+        int mirror_index = (frame_length - bin_index) & (frame_length - 1);
+        double window_re = 0.5 * (transform_real[bin_index] + transform_real[mirror_index]);
+        double window_im = 0.5 * (transform_imag[bin_index] - transform_imag[mirror_index]);
+        double frame_re = 0.5 * (transform_imag[bin_index] + transform_imag[mirror_index]);
+        double frame_im = -0.5 * (transform_real[bin_index] - transform_real[mirror_index]);
+        double cross_re = window_re * frame_re + window_im * frame_im;
+        double cross_im = window_re * frame_im - window_im * frame_re;
+        transform_real[bin_index] = cross_re;
+        transform_imag[bin_index] = cross_im;
+        transform_real[mirror_index] = cross_re;
+        transform_imag[mirror_index] = -cross_im;
+    }
+    execute_fft(*tracker_state.transform_plan, transform_real, transform_imag, true);
+
+    // The system forms d(tau) = e(0) + e(tau) - 2 r(tau) with a sliding window energy, then normalises cumulatively
+    double window_energy = 0.0;
+    for (int sample_index = 0; sample_index < integration_window; sample_index++) {
+        window_energy += frame_samples[sample_index] * frame_samples[sample_index];
+    }
+    double lagged_energy = window_energy;
+    double cumulative_difference = 0.0;
+    double* normalised_difference = tracker_state.normalised_difference.data();
+    normalised_difference[0] = 1.0;
+    for (int lag_value = 1; lag_value < integration_window; lag_value++) {
+        lagged_energy += frame_samples[lag_value + integration_window - 1] * frame_samples[lag_value + integration_window - 1] -
+                         frame_samples[lag_value - 1] * frame_samples[lag_value - 1];
+        double difference_value = max(0.0, window_energy + lagged_energy - 2.0 * transform_real[lag_value]);
+        cumulative_difference += difference_value;
+        normalised_difference[lag_value] = cumulative_difference > 1e-20 ? difference_value * lag_value / cumulative_difference : 1.0;
+    }
+}
+
+// Function declaration for parabolic refinement of a difference minimum into a frequency
+double refine_pitch_lag(const pitch_tracker_state& tracker_state, int lag_value) {
+    const double* normalised_difference = tracker_state.normalised_difference.data();
+    double left_value = normalised_difference[lag_value - 1];
+    double centre_value = normalised_difference[lag_value];
+    double right_value = normalised_difference[lag_value + 1];
+    double curvature = left_value - 2.0 * centre_value + right_value;
+    double refined_lag = lag_value + (curvature > 0.0 ? 0.5 * (left_value - right_value) / curvature : 0.0);
+    return SAMPLE_RATE / refined_lag;         // Function returns the refined frequency
+}
+
+// Function declaration for one pitch estimate from the current frame
+pitch_frame_estimate estimate_frame_pitch(pitch_tracker_state& tracker_state, const double* frame_samples) {
+    compute_normalised_difference(tracker_state, frame_samples);
+    const pitch_tracker_configuration& configuration = tracker_state.configuration;
+    const double* normalised_difference = tracker_state.normalised_difference.data();
+    pitch_frame_estimate frame_estimate;       // Local estimate structure instance
+    long long frame_start = (tracker_state.analysed_frame_count + 1) * configuration.hop_length - tracker_state.frame_length;
+    frame_estimate.frequency_hz = 0.0;
+    frame_estimate.voicing_confidence = 0.0;
+    frame_estimate.voiced_frame = false;
+    tracker_state.analysed_frame_count++;
+
+    // The system lists dips (local minima) in increasing lag order, which is the order YIN accepts them
+    int best_dip_lag = -1;
+    double best_dip_probability = 0.0;
+    int claimed_from = PYIN_THRESHOLD_COUNT;
+    double lowest_dip_value = 1e300;
+    int lowest_dip_lag = -1;
+    for (int lag_value = tracker_state.minimum_lag; lag_value <= tracker_state.maximum_lag; lag_value++) {
+        double dip_value = normalised_difference[lag_value];
+        if (dip_value > normalised_difference[lag_value - 1] || dip_value > normalised_difference[lag_value + 1]) {
+            continue;
+        }
+        if (dip_value < lowest_dip_value) {
+            lowest_dip_value = dip_value;
+            lowest_dip_lag = lag_value;
+        }
+        if (!configuration.probabilistic_voicing) {
+            if (dip_value < configuration.absolute_threshold) {
+                best_dip_lag = lag_value;
+                best_dip_probability = 1.0 - dip_value;
+                break;
+            }
+            continue;
+        }
+
+        // The first dip below a threshold claims that threshold's prior weight, so each deeper dip picks up the
+        // thresholds between its own value and the lowest earlier dip
+        double dip_probability = 0.0;
+        int first_threshold = 0;
+        while (first_threshold < claimed_from && (first_threshold + 1.0) / PYIN_THRESHOLD_COUNT <= dip_value) {
+            first_threshold++;
+        }
+        for (int threshold_index = first_threshold; threshold_index < claimed_from; threshold_index++) {
+            dip_probability += tracker_state.threshold_prior[threshold_index];
+        }
+        claimed_from = first_threshold;
+        frame_estimate.voicing_confidence += dip_probability;
+        if (dip_probability > best_dip_probability) {
+            best_dip_probability = dip_probability;
+            best_dip_lag = lag_value;
+        }
+    }
+
+    if (!configuration.probabilistic_voicing) {
+        // Plain YIN falls back to the deepest dip but reports it unvoiced
+        frame_estimate.voiced_frame = (best_dip_lag >= 0);
+        int chosen_lag = frame_estimate.voiced_frame ? best_dip_lag : lowest_dip_lag;
+        while (frame_estimate.voiced_frame && chosen_lag < tracker_state.maximum_lag &&
+               normalised_difference[chosen_lag + 1] < normalised_difference[chosen_lag]) {
+            chosen_lag++;
+        }
+        frame_estimate.voicing_confidence = chosen_lag >= 0 ? max(0.0, 1.0 - normalised_difference[chosen_lag]) : 0.0;
+        frame_estimate.frequency_hz = (frame_estimate.voiced_frame && chosen_lag >= 0) ? refine_pitch_lag(tracker_state, chosen_lag) : 0.0;
+    } else {
+        frame_estimate.voiced_frame = (best_dip_lag >= 0 && frame_estimate.voicing_confidence >= 0.5);
+        frame_estimate.frequency_hz = frame_estimate.voiced_frame ? refine_pitch_lag(tracker_state, best_dip_lag) : 0.0;
+    }
+
+    // The system timestamps the span actually compared, the window plus half the detected period
+    double compared_centre = 0.5 * tracker_state.integration_window +
+                             (frame_estimate.frequency_hz > 0.0 ? 0.5 * SAMPLE_RATE / frame_estimate.frequency_hz : 0.0);
+    frame_estimate.frame_time = (double(frame_start) + compared_centre) / SAMPLE_RATE;
+    return frame_estimate;                     // Function returns the frame estimate
+}
+
+// Function declaration for streaming pitch tracking over one planar block
+void feed_pitch_tracker(pitch_tracker_state& tracker_state, const audio_processing_buffer& source_buffer,
+                        vector<pitch_frame_estimate>& pitch_contour) {
+    // The system estimates each completed frame as soon as its hop arrives
+    stream_mono_hops(tracker_state.hop_history, source_buffer, [&](const double* frame_samples) {
+        pitch_contour.push_back(estimate_frame_pitch(tracker_state, frame_samples));
+    });
+}
+
+// Fingerprint hash layout: 8-bit anchor band, 6-bit band delta, 6-bit frame delta
+const int FINGERPRINT_HASH_BITS = 20;         // Bits per landmark hash and log2 of index buckets
+const int FINGERPRINT_TARGET_FRAMES = 63;     // Longest anchor-to-target frame distance
+const int FINGERPRINT_TARGET_BANDS = 31;      // Largest anchor-to-target band distance (two bins per band)
+const int FINGERPRINT_FAN_OUT = 5;            // Targets paired with each anchor
+const int FINGERPRINT_PEAKS_PER_FRAME = 5;    // Strongest new peaks accepted per frame
+const uint32_t FINGERPRINT_INDEX_MAGIC = 0x58504641; // "AFPX" file signature
+const uint32_t FINGERPRINT_INDEX_VERSION = 1;  // On-disk layout revision
+
+// Structure definition for a spectral peak awaiting landmark targets
+struct fingerprint_peak {
+    int frame_index;                          // Analysis frame of the peak
+    int bin_index;                            // Frequency bin of the peak
+    int pairs_formed;                         // Targets already paired with this anchor
+};
+
+// Structure definition for one landmark hash and its anchor time
+struct fingerprint_landmark {
+    uint32_t landmark_hash;                   // Packed anchor band, band delta and frame delta
+    uint32_t anchor_frame;                    // Analysis frame of the anchor peak
+};
+
+// Structure definition for streaming landmark extraction state
+struct fingerprint_extractor_state {
+    int frame_length;                         // STFT frame length (uses the baked Hann window)
+    int hop_length;                           // Frames between analysis frames
+    int spectrum_bins;                        // Non-redundant bins per frame
+    const fft_transform_plan* transform_plan; // Shared plan for the frame length
+    mono_hop_history hop_history;             // Sliding frame of mono downmix
+    int analysed_frame_count;                 // Frames analysed so far
+    vector<double> transform_real;            // Transform scratch, real parts
+    vector<double> transform_imag;            // Transform scratch, imaginary parts
+    vector<double> masking_threshold_db;      // Decaying per-bin threshold raised by accepted peaks
+    vector<fingerprint_peak> pending_anchors; // Peaks still inside the target zone of future frames
+};
+
+// Structure definition for accumulating postings before the index is written
+struct fingerprint_index_builder {
+    vector<uint32_t> posting_hashes;          // Landmark hash per posting
+    vector<uint64_t> posting_values;          // Track identifier (high word) and anchor frame (low word)
+};
+
+// Structure definition for an opened on-disk inverted index
+struct fingerprint_index_reader {
+    ifstream index_stream;                    // Open index file for posting reads
+    vector<uint64_t> bucket_offsets;          // First posting of every hash bucket plus end sentinel
+    uint64_t postings_start;                  // Byte position of the posting array
+    bool index_ready;                         // Whether the header and offsets were read successfully
+};
+
+// Structure definition for a scored query match
+struct fingerprint_match {
+    uint32_t track_identifier;                // Matching library track
+    int aligned_votes;                        // Landmarks agreeing on the best time offset
+    double offset_seconds;                    // Query start position inside the track
+};
+
+// Function declaration for landmark extractor initialization
+fingerprint_extractor_state initialize_fingerprint_extractor() {
+    fingerprint_extractor_state extractor_state; // Local state structure instance
+    extractor_state.frame_length = AUDIO_BUFFER_SIZE;
+    extractor_state.hop_length = AUDIO_BUFFER_SIZE / 2;
+    extractor_state.spectrum_bins = AUDIO_BUFFER_SIZE / 2 + 1;
+    extractor_state.transform_plan = &acquire_fft_plan(AUDIO_BUFFER_SIZE);
+    extractor_state.hop_history = initialize_mono_hop_history(AUDIO_BUFFER_SIZE, extractor_state.hop_length);
+    extractor_state.analysed_frame_count = 0;
+    extractor_state.transform_real.assign(AUDIO_BUFFER_SIZE, 0.0);
+    extractor_state.transform_imag.assign(AUDIO_BUFFER_SIZE, 0.0);
+    extractor_state.masking_threshold_db.assign(extractor_state.spectrum_bins, -120.0);
+    return extractor_state;                    // Function returns prepared extractor state
+}
+
+// Function declaration for peak picking and landmark pairing on the current frame
+void extract_frame_landmarks(fingerprint_extractor_state& extractor_state, const double* frame_samples,
+                             vector<fingerprint_landmark>& landmarks) {
+    int frame_length = extractor_state.frame_length;
+    double* transform_real = extractor_state.transform_real.data();
+    double* transform_imag = extractor_state.transform_imag.data();
+    for (int sample_index = 0; sample_index < frame_length; sample_index++) {
+        transform_real[sample_index] = frame_samples[sample_index] * HANN_WINDOW_TABLE[sample_index];
+        transform_imag[sample_index] = 0.0;
+    }
+    execute_fft(*extractor_state.transform_plan, transform_real, transform_imag, false);
+
+    // The system converts to decibels in place and lets the masking threshold decay
+    int band_limit = extractor_state.spectrum_bins - 2;
+    double frame_maximum_db = -300.0;
+    for (int bin_index = 0; bin_index < extractor_state.spectrum_bins; bin_index++) {
+        transform_real[bin_index] = 10.0 * log10(transform_real[bin_index] * transform_real[bin_index] +
+                                                 transform_imag[bin_index] * transform_imag[bin_index] + 1e-20);
+        frame_maximum_db = max(frame_maximum_db, transform_real[bin_index]);
+        extractor_state.masking_threshold_db[bin_index] -= 0.5;
+    }
+
+    // The system accepts the strongest local maxima that clear both the mask and a floor below the frame maximum
+    vector<pair<double, int>> candidate_peaks;
+    for (int bin_index = 2; bin_index < band_limit; bin_index++) {
+        double bin_level = transform_real[bin_index];
+        if (bin_level > transform_real[bin_index - 1] && bin_level >= transform_real[bin_index + 1] &&
+            bin_level > extractor_state.masking_threshold_db[bin_index] && bin_level > frame_maximum_db - 50.0) {
+            candidate_peaks.push_back({bin_level, bin_index});
+        }
+    }
+    sort(candidate_peaks.rbegin(), candidate_peaks.rend());
+    int frame_index = extractor_state.analysed_frame_count;
+    vector<fingerprint_peak> frame_peaks;
+    for (const pair<double, int>& candidate_peak : candidate_peaks) {
+        if (int(frame_peaks.size()) == FINGERPRINT_PEAKS_PER_FRAME) {
+            break;
+        }
+        if (candidate_peak.first <= extractor_state.masking_threshold_db[candidate_peak.second]) {
+            continue;
+        }
+        frame_peaks.push_back({frame_index, candidate_peak.second, 0});
+        for (int spread_offset = -30; spread_offset <= 30; spread_offset++) {
+            int spread_bin = candidate_peak.second + spread_offset;
+            if (spread_bin >= 0 && spread_bin < extractor_state.spectrum_bins) {
+                extractor_state.masking_threshold_db[spread_bin] = max(extractor_state.masking_threshold_db[spread_bin],
+                                                                       candidate_peak.first - 1.0 * abs(spread_offset));
+            }
+        }
+    }
+
+    // The system pairs the new peaks as targets of earlier anchors, earliest anchors first
+    for (fingerprint_peak& anchor_peak : extractor_state.pending_anchors) {
+        for (const fingerprint_peak& target_peak : frame_peaks) {
+            int band_delta = (target_peak.bin_index >> 1) - (anchor_peak.bin_index >> 1);
+            if (anchor_peak.pairs_formed == FINGERPRINT_FAN_OUT || abs(band_delta) > FINGERPRINT_TARGET_BANDS) {
+                continue;
+            }
+            uint32_t landmark_hash = (uint32_t(anchor_peak.bin_index >> 1) << 12) |
+                                     (uint32_t(band_delta + FINGERPRINT_TARGET_BANDS + 1) << 6) |
+                                     uint32_t(frame_index - anchor_peak.frame_index);
+            landmarks.push_back({landmark_hash, uint32_t(anchor_peak.frame_index)});
+            anchor_peak.pairs_formed++;
+        }
+    }
+    extractor_state.pending_anchors.erase(
+        remove_if(extractor_state.pending_anchors.begin(), extractor_state.pending_anchors.end(),
+                  [&](const fingerprint_peak& anchor_peak) {
+                      return anchor_peak.pairs_formed == FINGERPRINT_FAN_OUT ||
+                             frame_index + 1 - anchor_peak.frame_index > FINGERPRINT_TARGET_FRAMES;
+                  }),
+        extractor_state.pending_anchors.end());
+    extractor_state.pending_anchors.insert(extractor_state.pending_anchors.end(), frame_peaks.begin(), frame_peaks.end());
+    extractor_state.analysed_frame_count++;
+}
+
+// Function declaration for streaming landmark extraction over one planar block
+void feed_fingerprint_extractor(fingerprint_extractor_state& extractor_state, const audio_processing_buffer& source_buffer,
+                                vector<fingerprint_landmark>& landmarks) {
+    // The system fingerprints each completed frame as soon as its hop arrives
+    stream_mono_hops(extractor_state.hop_history, source_buffer, [&](const double* frame_samples) {
+        extract_frame_landmarks(extractor_state, frame_samples, landmarks);
+    });
+}
+
+// Function declaration for adding one track's landmarks to the index builder
+void add_track_to_fingerprint_index(fingerprint_index_builder& index_builder, uint32_t track_identifier,
+                                    const vector<fingerprint_landmark>& landmarks) {
+    for (const fingerprint_landmark& landmark : landmarks) {
+        index_builder.posting_hashes.push_back(landmark.landmark_hash);
+        index_builder.posting_values.push_back((uint64_t(track_identifier) << 32) | landmark.anchor_frame);
+    }
+}
+
+// Function declaration for writing the inverted index grouped by hash
+bool write_fingerprint_index(const fingerprint_index_builder& index_builder, const string& index_path) {
+    // The system counting-sorts postings into hash buckets in linear time
+    size_t bucket_count = size_t(1) << FINGERPRINT_HASH_BITS;
+    vector<uint64_t> bucket_offsets(bucket_count + 1, 0);
+    for (uint32_t landmark_hash : index_builder.posting_hashes) {
+        bucket_offsets[landmark_hash + 1]++;
+    }
+    partial_sum(bucket_offsets.begin(), bucket_offsets.end(), bucket_offsets.begin());
+    vector<uint64_t> bucket_cursor(bucket_offsets.begin(), bucket_offsets.end() - 1);
+    vector<uint64_t> sorted_postings(index_builder.posting_values.size());
+    for (size_t posting_index = 0; posting_index < index_builder.posting_values.size(); posting_index++) {
+        sorted_postings[bucket_cursor[index_builder.posting_hashes[posting_index]]++] = index_builder.posting_values[posting_index];
+    }
+
+    ofstream index_stream(index_path, ios::binary | ios::trunc);
+    if (!index_stream) {
+        return false;
+    }
+    uint32_t header_words[3] = {FINGERPRINT_INDEX_MAGIC, FINGERPRINT_INDEX_VERSION, uint32_t(FINGERPRINT_HASH_BITS)};
+    uint64_t posting_total = sorted_postings.size();
+    index_stream.write(reinterpret_cast<const char*>(header_words), sizeof(header_words));
+    index_stream.write(reinterpret_cast<const char*>(&posting_total), sizeof(posting_total));
+    index_stream.write(reinterpret_cast<const char*>(bucket_offsets.data()), streamsize(bucket_offsets.size() * sizeof(uint64_t)));
+    index_stream.write(reinterpret_cast<const char*>(sorted_postings.data()), streamsize(sorted_postings.size() * sizeof(uint64_t)));
+    return bool(index_stream);                 // Function returns whether every write succeeded
+}
+
+// Function declaration for opening an inverted index and loading its bucket table
+fingerprint_index_reader open_fingerprint_index(const string& index_path) {
+    fingerprint_index_reader index_reader;     // Local reader structure instance
+    index_reader.index_ready = false;
+    index_reader.index_stream.open(index_path, ios::binary);
+    uint32_t header_words[3] = {0, 0, 0};
+    uint64_t posting_total = 0;
+    index_reader.index_stream.read(reinterpret_cast<char*>(header_words), sizeof(header_words));
+    index_reader.index_stream.read(reinterpret_cast<char*>(&posting_total), sizeof(posting_total));
+    if (!index_reader.index_stream || header_words[0] != FINGERPRINT_INDEX_MAGIC ||
+        header_words[1] != FINGERPRINT_INDEX_VERSION || header_words[2] != uint32_t(FINGERPRINT_HASH_BITS)) {
+        return index_reader;
+    }
+
+    // The system keeps only the bucket table resident; postings stay on disk until a query touches them
+    index_reader.bucket_offsets.resize((size_t(1) << FINGERPRINT_HASH_BITS) + 1);
+    index_reader.index_stream.read(reinterpret_cast<char*>(index_reader.bucket_offsets.data()),
+                                   streamsize(index_reader.bucket_offsets.size() * sizeof(uint64_t)));
+    index_reader.postings_start = uint64_t(index_reader.index_stream.tellg());
+    index_reader.index_ready = bool(index_reader.index_stream) && index_reader.bucket_offsets.back() == posting_total;
+    return index_reader;                       // Function returns the opened reader
+}
+
+// Function declaration for query scoring by time-offset histogram
+vector<fingerprint_match> query_fingerprint_index(fingerprint_index_reader& index_reader,
+                                                  const vector<fingerprint_landmark>& query_landmarks, int maximum_results) {
+    vector<fingerprint_match> ranked_matches;
+    if (!index_reader.index_ready) {
+        return ranked_matches;
+    }
+
+    // The system visits each distinct query hash once, in file order, collecting (track, offset) votes
+    vector<fingerprint_landmark> ordered_queries(query_landmarks);
+    sort(ordered_queries.begin(), ordered_queries.end(), [](const fingerprint_landmark& left, const fingerprint_landmark& right) {
+        return left.landmark_hash < right.landmark_hash;
+    });
+    vector<uint64_t> offset_votes;
+    vector<uint64_t> bucket_postings;
+    for (size_t query_index = 0; query_index < ordered_queries.size();) {
+        uint32_t landmark_hash = ordered_queries[query_index].landmark_hash;
+        size_t run_end = query_index;
+        while (run_end < ordered_queries.size() && ordered_queries[run_end].landmark_hash == landmark_hash) {
+            run_end++;
+        }
+        uint64_t bucket_begin = index_reader.bucket_offsets[landmark_hash];
+        uint64_t bucket_end = index_reader.bucket_offsets[landmark_hash + 1];
+        if (bucket_end > bucket_begin) {
+            bucket_postings.resize(bucket_end - bucket_begin);
+            index_reader.index_stream.seekg(streamoff(index_reader.postings_start + bucket_begin * sizeof(uint64_t)));
+            index_reader.index_stream.read(reinterpret_cast<char*>(bucket_postings.data()),
+                                           streamsize(bucket_postings.size() * sizeof(uint64_t)));
+            for (size_t run_index = query_index; run_index < run_end; run_index++) {
+                uint32_t query_frame = ordered_queries[run_index].anchor_frame;
+                for (uint64_t posting_value : bucket_postings) {
+                    uint32_t track_frame = uint32_t(posting_value);
+                    uint64_t offset_key = uint64_t(uint32_t(int64_t(track_frame) - int64_t(query_frame) + (1 << 30)));
+                    offset_votes.push_back((posting_value & 0xFFFFFFFF00000000ULL) | offset_key);
+                }
+            }
+        }
+        query_index = run_end;
+    }
+
+    // The system sorts the votes so every (track, offset) histogram bin becomes one contiguous run
+    sort(offset_votes.begin(), offset_votes.end());
+    vector<fingerprint_match> track_best;
+    for (size_t vote_index = 0; vote_index < offset_votes.size();) {
+        size_t run_end = vote_index;
+        while (run_end < offset_votes.size() && offset_votes[run_end] == offset_votes[vote_index]) {
+            run_end++;
+        }
+        uint32_t track_identifier = uint32_t(offset_votes[vote_index] >> 32);
+        int offset_frames = int(int64_t(uint32_t(offset_votes[vote_index])) - (1 << 30));
+        if (track_best.empty() || track_best.back().track_identifier != track_identifier) {
+            track_best.push_back({track_identifier, 0, 0.0});
+        }
+        if (int(run_end - vote_index) > track_best.back().aligned_votes) {
+            track_best.back().aligned_votes = int(run_end - vote_index);
+            track_best.back().offset_seconds = offset_frames * double(AUDIO_BUFFER_SIZE / 2) / SAMPLE_RATE;
+        }
+        vote_index = run_end;
+    }
+    sort(track_best.begin(), track_best.end(), [](const fingerprint_match& left, const fingerprint_match& right) {
+        return left.aligned_votes > right.aligned_votes;
+    });
+    track_best.resize(min<size_t>(track_best.size(), size_t(maximum_results)));
+    return track_best;                         // Function returns the best-aligned tracks
+}
+
+// Track embedding layout: MFCC means and deviations followed by spectral shape and loudness statistics
+const int MEL_BAND_COUNT = 26;                 // Triangular mel bands feeding the cepstrum
+const int MFCC_COEFFICIENT_COUNT = 13;         // Cepstral coefficients kept per frame
+const int TRACK_EMBEDDING_DIMENSION = 32;      // Floats per track embedding (31 features padded to a lane multiple)
+
+// Function declaration for compile-time orthonormal DCT-II table generation from mel bands to cepstrum
+constexpr fixed_size_table<double, MFCC_COEFFICIENT_COUNT * MEL_BAND_COUNT> generate_mfcc_dct_table() {
+    fixed_size_table<double, MFCC_COEFFICIENT_COUNT * MEL_BAND_COUNT> dct_table;
+    for (int coefficient_index = 0; coefficient_index < MFCC_COEFFICIENT_COUNT; coefficient_index++) {
+        double row_scale = constexpr_sqrt((coefficient_index == 0 ? 1.0 : 2.0) / MEL_BAND_COUNT);
+        for (int band_index = 0; band_index < MEL_BAND_COUNT; band_index++) {
+            dct_table[coefficient_index * MEL_BAND_COUNT + band_index] =
+                row_scale * constexpr_cos(M_PI * coefficient_index * (band_index + 0.5) / MEL_BAND_COUNT);
+        }
+    }
+    return dct_table;                          // Function returns the populated transform
+}
+
+constexpr auto MFCC_DCT_TABLE = generate_mfcc_dct_table();
+
+// Structure definition for streaming per-track embedding accumulation
+struct track_embedding_state {
+    int frame_length;                         // STFT frame length (uses the baked Hann window)
+    int hop_length;                           // Frames between analysis frames
+    int spectrum_bins;                        // Non-redundant bins per frame
+    const fft_transform_plan* transform_plan; // Shared plan for the frame length
+    mono_hop_history hop_history;             // Sliding frame of mono downmix
+    vector<double> transform_real;            // Transform scratch, real parts
+    vector<double> transform_imag;            // Transform scratch, imaginary parts
+    vector<int> mel_band_edges;               // Lower, centre and upper bin of every mel band
+    double cepstrum_sum[MFCC_COEFFICIENT_COUNT];        // Running MFCC sums
+    double cepstrum_square_sum[MFCC_COEFFICIENT_COUNT]; // Running MFCC squared sums
+    double centroid_sum;                      // Running spectral centroid sum (fraction of Nyquist)
+    double rolloff_sum;                       // Running 85% rolloff sum (fraction of Nyquist)
+    double flatness_sum;                      // Running spectral flatness sum
+    double loudness_sum;                      // Running frame level sum in dB
+    double loudness_square_sum;               // Running frame level squared sum
+    long long active_frame_count;             // Frames above the silence floor
+};
+
+// Function declaration for track embedding accumulator initialization
+track_embedding_state initialize_track_embedding() {
+    track_embedding_state embedding_state = {}; // Local state structure instance with zeroed sums
+    embedding_state.frame_length = AUDIO_BUFFER_SIZE;
+    embedding_state.hop_length = AUDIO_BUFFER_SIZE / 2;
+    embedding_state.spectrum_bins = AUDIO_BUFFER_SIZE / 2 + 1;
+    embedding_state.transform_plan = &acquire_fft_plan(AUDIO_BUFFER_SIZE);
+    embedding_state.hop_history = initialize_mono_hop_history(AUDIO_BUFFER_SIZE, embedding_state.hop_length);
+    embedding_state.transform_real.assign(AUDIO_BUFFER_SIZE, 0.0);
+    embedding_state.transform_imag.assign(AUDIO_BUFFER_SIZE, 0.0);
+
+    // The system spaces band edges uniformly on the mel scale between 40 Hz and 16 kHz
+    auto hz_to_mel = [](double frequency_hz) { return 2595.0 * log10(1.0 + frequency_hz / 700.0); };
+    double lowest_mel = hz_to_mel(40.0);
+    double highest_mel = hz_to_mel(16000.0);
+    for (int edge_index = 0; edge_index < MEL_BAND_COUNT + 2; edge_index++) {
+        double edge_mel = lowest_mel + (highest_mel - lowest_mel) * edge_index / (MEL_BAND_COUNT + 1);
+        double edge_hz = 700.0 * (pow(10.0, edge_mel / 2595.0) - 1.0);
+        int edge_bin = int(lround(edge_hz * AUDIO_BUFFER_SIZE / SAMPLE_RATE));
+        embedding_state.mel_band_edges.push_back(edge_index > 0 ? max(edge_bin, embedding_state.mel_band_edges.back() + 1) : edge_bin);
+    }
+    return embedding_state;                    // Function returns prepared accumulator
+}
+
+// Function declaration for per-frame feature accumulation
+void accumulate_embedding_frame(track_embedding_state& embedding_state, const double* frame_samples) {
+    int frame_length = embedding_state.frame_length;
+    double* transform_real = embedding_state.transform_real.data();
+    double* transform_imag = embedding_state.transform_imag.data();
+    double frame_energy = 0.0;
+    for (int sample_index = 0; sample_index < frame_length; sample_index++) {
+        frame_energy += frame_samples[sample_index] * frame_samples[sample_index];
+        transform_real[sample_index] = frame_samples[sample_index] * HANN_WINDOW_TABLE[sample_index];
+        transform_imag[sample_index] = 0.0;
+    }
+    double frame_level_db = 10.0 * log10(frame_energy / frame_length + 1e-20);
+    if (frame_level_db < -70.0) {
+        return;
+    }
+    execute_fft(*embedding_state.transform_plan, transform_real, transform_imag, false);
+
+    // The system reduces the power spectrum to shape statistics, flooring bins 80 dB below the frame peak so
+    // near-empty regions do not swing the log-domain features when low-level noise or dither is added
+    double power_peak = 0.0;
+    for (int bin_index = 0; bin_index < embedding_state.spectrum_bins; bin_index++) {
+        transform_real[bin_index] = transform_real[bin_index] * transform_real[bin_index] + transform_imag[bin_index] * transform_imag[bin_index];
+        power_peak = max(power_peak, transform_real[bin_index]);
+    }
+    double power_floor = 1e-8 * power_peak + 1e-30;
+    double power_total = 0.0;
+    double weighted_bin_total = 0.0;
+    double log_power_total = 0.0;
+    for (int bin_index = 0; bin_index < embedding_state.spectrum_bins; bin_index++) {
+        double bin_power = max(transform_real[bin_index], power_floor);
+        transform_real[bin_index] = bin_power;
+        power_total += bin_power;
+        weighted_bin_total += bin_power * bin_index;
+        log_power_total += log(bin_power);
+    }
+    double rolloff_target = 0.85 * power_total;
+    double rolloff_running = 0.0;
+    int rolloff_bin = 0;
+    while (rolloff_bin < embedding_state.spectrum_bins - 1 && rolloff_running + transform_real[rolloff_bin] < rolloff_target) {
+        rolloff_running += transform_real[rolloff_bin++];
+    }
+    double nyquist_bin = embedding_state.spectrum_bins - 1.0;
+    embedding_state.centroid_sum += weighted_bin_total / power_total / nyquist_bin;
+    embedding_state.rolloff_sum += rolloff_bin / nyquist_bin;
+    embedding_state.flatness_sum += exp(log_power_total / embedding_state.spectrum_bins) / (power_total / embedding_state.spectrum_bins);
+    embedding_state.loudness_sum += frame_level_db;
+    embedding_state.loudness_square_sum += frame_level_db * frame_level_db;
+
+    // The system applies the triangular mel filterbank and the baked DCT to obtain the cepstrum
+    double log_mel_energy[MEL_BAND_COUNT];
+    for (int band_index = 0; band_index < MEL_BAND_COUNT; band_index++) {
+        int lower_bin = embedding_state.mel_band_edges[band_index];
+        int centre_bin = embedding_state.mel_band_edges[band_index + 1];
+        int upper_bin = embedding_state.mel_band_edges[band_index + 2];
+        double band_energy = 0.0;
+        for (int bin_index = lower_bin; bin_index < upper_bin; bin_index++) {
+            double band_weight = bin_index < centre_bin ? double(bin_index - lower_bin) / (centre_bin - lower_bin)
+                                                        : double(upper_bin - bin_index) / (upper_bin - centre_bin);
+            band_energy += band_weight * transform_real[bin_index];
+        }
+        log_mel_energy[band_index] = log(band_energy);
+    }
+    for (int coefficient_index = 0; coefficient_index < MFCC_COEFFICIENT_COUNT; coefficient_index++) {
+        double cepstral_value = 0.0;
+        for (int band_index = 0; band_index < MEL_BAND_COUNT; band_index++) {
+            cepstral_value += MFCC_DCT_TABLE[coefficient_index * MEL_BAND_COUNT + band_index] * log_mel_energy[band_index];
+        }
+        embedding_state.cepstrum_sum[coefficient_index] += cepstral_value;
+        embedding_state.cepstrum_square_sum[coefficient_index] += cepstral_value * cepstral_value;
+    }
+    embedding_state.active_frame_count++;
+}
+
+// Function declaration for streaming embedding accumulation over one planar block
+void feed_track_embedding(track_embedding_state& embedding_state, const audio_processing_buffer& source_buffer) {
+    // The system accumulates each completed frame as soon as its hop arrives
+    stream_mono_hops(embedding_state.hop_history, source_buffer, [&](const double* frame_samples) {
+        accumulate_embedding_frame(embedding_state, frame_samples);
+    });
+}
+
+// Function declaration for fixed-length embedding assembly from the accumulated statistics
+vector<float> finalize_track_embedding(const track_embedding_state& embedding_state) {
+    vector<float> track_embedding(TRACK_EMBEDDING_DIMENSION, 0.0f);
+    double frame_count = double(max(1LL, embedding_state.active_frame_count));
+
+    // The system scales each statistic to a comparable unit range so no feature group dominates distances
+    for (int coefficient_index = 0; coefficient_index < MFCC_COEFFICIENT_COUNT; coefficient_index++) {
+        double cepstral_mean = embedding_state.cepstrum_sum[coefficient_index] / frame_count;
+        double cepstral_variance = max(0.0, embedding_state.cepstrum_square_sum[coefficient_index] / frame_count - cepstral_mean * cepstral_mean);
+        track_embedding[coefficient_index] = float(cepstral_mean / (coefficient_index == 0 ? 50.0 : 10.0));
+        track_embedding[MFCC_COEFFICIENT_COUNT + coefficient_index] = float(sqrt(cepstral_variance) / 10.0);
+    }
+    double loudness_mean = embedding_state.loudness_sum / frame_count;
+    double loudness_variance = max(0.0, embedding_state.loudness_square_sum / frame_count - loudness_mean * loudness_mean);
+    track_embedding[2 * MFCC_COEFFICIENT_COUNT + 0] = float(embedding_state.centroid_sum / frame_count * 4.0);
+    track_embedding[2 * MFCC_COEFFICIENT_COUNT + 1] = float(embedding_state.rolloff_sum / frame_count * 4.0);
+    track_embedding[2 * MFCC_COEFFICIENT_COUNT + 2] = float(embedding_state.flatness_sum / frame_count * 4.0);
+    track_embedding[2 * MFCC_COEFFICIENT_COUNT + 3] = float(loudness_mean / 30.0);
+    track_embedding[2 * MFCC_COEFFICIENT_COUNT + 4] = float(sqrt(loudness_variance) / 10.0);
+    return track_embedding;                    // Function returns the fixed-length embedding
+}
+
+// Structure definition for a hierarchical navigable small-world graph over fixed-length float vectors
+struct hnsw_index {
+    int dimension;                            // Floats per stored vector (multiple of the lane count)
+    int neighbour_limit;                      // Links per node on upper layers
+    int base_neighbour_limit;                 // Links per node on the base layer
+    int construction_breadth;                 // Candidate list size while inserting
+    double level_scale;                       // Multiplier for the geometric level distribution
+    vector<float> stored_vectors;             // Vectors in insertion order (node, dimension)
+    vector<int> node_levels;                  // Highest layer of each node
+    vector<int> base_links;                   // Base-layer links (node, base limit)
+    vector<int> base_link_counts;             // Base-layer link count per node
+    vector<vector<int>> upper_links;          // Upper-layer links per node (layer - 1, limit)
+    vector<vector<int>> upper_link_counts;    // Upper-layer link count per node and layer
+    int entry_point;                          // Node on the top layer where searches start
+    int top_level;                            // Highest populated layer
+    mt19937_64 level_generator;               // Deterministic layer assignment source
+    vector<uint32_t> visit_marks;             // Epoch stamp per node for visited tests
+    uint32_t visit_epoch;                     // Current search epoch
+};
+
+// Function declaration for HNSW index initialization
+hnsw_index initialize_hnsw_index(int dimension, int neighbour_limit = 16, int construction_breadth = 100, uint64_t seed_value = 45) {
+    hnsw_index vector_index;                   // Local index structure instance
+    vector_index.dimension = dimension;
+    vector_index.neighbour_limit = min(neighbour_limit, 32);
+    vector_index.base_neighbour_limit = 2 * vector_index.neighbour_limit;
+    vector_index.construction_breadth = construction_breadth;
+    vector_index.level_scale = 1.0 / log(double(vector_index.neighbour_limit));
+    vector_index.entry_point = -1;
+    vector_index.top_level = -1;
+    vector_index.level_generator.seed(seed_value);
+    vector_index.visit_epoch = 0;
+    return vector_index;                       // Function returns empty index
+}
+
+// Function declaration for batched squared Euclidean distances from one query to a gathered set of vectors
+void compute_batch_distances(const float* query_vector, const float* vector_base, const int* vector_ids, int batch_count,
+                             int dimension, float* batch_distances) {
+    // The system accumulates each distance in lane-wide partial sums so the inner loop maps onto vector registers
+    for (int batch_index = 0; batch_index < batch_count; batch_index++) {
+        const float* candidate_vector = vector_base + size_t(vector_ids[batch_index]) * dimension;
+        float lane_sum[SIMD_LANE_COUNT] = {};
+        for (int dimension_start = 0; dimension_start < dimension; dimension_start += SIMD_LANE_COUNT) {
+            for (int lane_index = 0; lane_index < SIMD_LANE_COUNT; lane_index++) {
+                float component_delta = query_vector[dimension_start + lane_index] - candidate_vector[dimension_start + lane_index];
+                lane_sum[lane_index] += component_delta * component_delta;
+            }
+        }
+        float distance_total = 0.0f;
+        for (int lane_index = 0; lane_index < SIMD_LANE_COUNT; lane_index++) {
+            distance_total += lane_sum[lane_index];
+        }
+        batch_distances[batch_index] = distance_total;
+    }
+}
+
+// Function declaration for link list access on any layer
+int* access_hnsw_links(hnsw_index& vector_index, int node_index, int layer_index, int*& link_count) {
+    if (layer_index == 0) {
+        link_count = &vector_index.base_link_counts[node_index];
+        return vector_index.base_links.data() + size_t(node_index) * vector_index.base_neighbour_limit;
+    }
+    link_count = &vector_index.upper_link_counts[node_index][layer_index - 1];
+    return vector_index.upper_links[node_index].data() + size_t(layer_index - 1) * vector_index.neighbour_limit;
+}
+
+// Function declaration for best-first search on one layer returning candidates nearest first
+vector<pair<float, int>> search_hnsw_layer(hnsw_index& vector_index, const float* query_vector,
+                                           const vector<pair<float, int>>& entry_candidates, int search_breadth, int layer_index) {
+    // The system stamps visited nodes with a fresh epoch instead of clearing a set per search
+    if (++vector_index.visit_epoch == 0) {
+        fill(vector_index.visit_marks.begin(), vector_index.visit_marks.end(), 0u);
+        vector_index.visit_epoch = 1;
+    }
+    priority_queue<pair<float, int>, vector<pair<float, int>>, greater<pair<float, int>>> frontier;
+    priority_queue<pair<float, int>> nearest_found;
+    for (const pair<float, int>& entry_candidate : entry_candidates) {
+        vector_index.visit_marks[entry_candidate.second] = vector_index.visit_epoch;
+        frontier.push(entry_candidate);
+        nearest_found.push(entry_candidate);
+    }
+    while (int(nearest_found.size()) > search_breadth) {
+        nearest_found.pop();
+    }
+
+    int unvisited_batch[64];
+    float batch_distances[64];
+    while (!frontier.empty()) {
+        pair<float, int> closest_frontier = frontier.top();
+        if (closest_frontier.first > nearest_found.top().first && int(nearest_found.size()) >= search_breadth) {
+            break;
+        }
+        frontier.pop();
+
+        // The system gathers all unvisited neighbours first and scores them in one batched kernel call
+        int* link_count = nullptr;
+        int* node_links = access_hnsw_links(vector_index, closest_frontier.second, layer_index, link_count);
+        int batch_count = 0;
+        for (int link_index = 0; link_index < *link_count; link_index++) {
+            int neighbour_node = node_links[link_index];
+            if (vector_index.visit_marks[neighbour_node] != vector_index.visit_epoch) {
+                vector_index.visit_marks[neighbour_node] = vector_index.visit_epoch;
+                unvisited_batch[batch_count++] = neighbour_node;
+            }
+        }
+        compute_batch_distances(query_vector, vector_index.stored_vectors.data(), unvisited_batch, batch_count,
+                                vector_index.dimension, batch_distances);
+        for (int batch_index = 0; batch_index < batch_count; batch_index++) {
+            if (int(nearest_found.size()) < search_breadth || batch_distances[batch_index] < nearest_found.top().first) {
+                frontier.push({batch_distances[batch_index], unvisited_batch[batch_index]});
+                nearest_found.push({batch_distances[batch_index], unvisited_batch[batch_index]});
+                if (int(nearest_found.size()) > search_breadth) {
+                    nearest_found.pop();
+                }
+            }
+        }
+    }
+
+    vector<pair<float, int>> ordered_results(nearest_found.size());
+    for (int result_index = int(ordered_results.size()) - 1; result_index >= 0; result_index--) {
+        ordered_results[result_index] = nearest_found.top();
+        nearest_found.pop();
+    }
+    return ordered_results;                    // Function returns candidates nearest first
+}
+
+// Function declaration for diversity-preserving neighbour selection from candidates sorted nearest first
+vector<int> select_hnsw_neighbours(hnsw_index& vector_index, const vector<pair<float, int>>& sorted_candidates, int neighbour_limit) {
+    // The system keeps a candidate only if it is closer to the base than to every neighbour already kept
+    vector<int> selected_nodes;
+    vector<int> pruned_nodes;
+    for (const pair<float, int>& candidate : sorted_candidates) {
+        if (int(selected_nodes.size()) == neighbour_limit) {
+            break;
+        }
+        const float* candidate_vector = vector_index.stored_vectors.data() + size_t(candidate.second) * vector_index.dimension;
+        float selected_distances[64];
+        compute_batch_distances(candidate_vector, vector_index.stored_vectors.data(), selected_nodes.data(),
+                                int(selected_nodes.size()), vector_index.dimension, selected_distances);
+        bool diverse_candidate = true;
+        for (size_t selected_index = 0; selected_index < selected_nodes.size() && diverse_candidate; selected_index++) {
+            diverse_candidate = selected_distances[selected_index] >= candidate.first;
+        }
+        (diverse_candidate ? selected_nodes : pruned_nodes).push_back(candidate.second);
+    }
+
+    // Pruned candidates refill any remaining slots so sparse regions keep full connectivity
+    for (size_t pruned_index = 0; pruned_index < pruned_nodes.size() && int(selected_nodes.size()) < neighbour_limit; pruned_index++) {
+        selected_nodes.push_back(pruned_nodes[pruned_index]);
+    }
+    return selected_nodes;                     // Function returns chosen neighbours
+}
+
+// Function declaration for incremental vector insertion
+int insert_hnsw_vector(hnsw_index& vector_index, const float* new_vector) {
+    int new_node = int(vector_index.node_levels.size());
+    int node_level = int(-log(1.0 - uniform_real_distribution<double>(0.0, 1.0)(vector_index.level_generator)) * vector_index.level_scale);
+    vector_index.stored_vectors.insert(vector_index.stored_vectors.end(), new_vector, new_vector + vector_index.dimension);
+    vector_index.node_levels.push_back(node_level);
+    vector_index.base_links.resize(vector_index.base_links.size() + vector_index.base_neighbour_limit, -1);
+    vector_index.base_link_counts.push_back(0);
+    vector_index.upper_links.emplace_back(size_t(node_level) * vector_index.neighbour_limit, -1);
+    vector_index.upper_link_counts.emplace_back(node_level, 0);
+    vector_index.visit_marks.push_back(0);
+    if (vector_index.entry_point < 0) {
+        vector_index.entry_point = new_node;
+        vector_index.top_level = node_level;
+        return new_node;
+    }
+
+    // The system descends greedily through layers above the new node's level
+    const float* query_vector = vector_index.stored_vectors.data() + size_t(new_node) * vector_index.dimension;
+    float entry_distance = 0.0f;
+    compute_batch_distances(query_vector, vector_index.stored_vectors.data(), &vector_index.entry_point, 1,
+                            vector_index.dimension, &entry_distance);
+    vector<pair<float, int>> entry_candidates = {{entry_distance, vector_index.entry_point}};
+    for (int layer_index = vector_index.top_level; layer_index > node_level; layer_index--) {
+        entry_candidates = search_hnsw_layer(vector_index, query_vector, entry_candidates, 1, layer_index);
+    }
+
+    // The system links the node on each shared layer and shrinks any neighbour list that overflows
+    for (int layer_index = min(node_level, vector_index.top_level); layer_index >= 0; layer_index--) {
+        entry_candidates = search_hnsw_layer(vector_index, query_vector, entry_candidates, vector_index.construction_breadth, layer_index);
+        int layer_limit = layer_index == 0 ? vector_index.base_neighbour_limit : vector_index.neighbour_limit;
+        vector<int> chosen_neighbours = select_hnsw_neighbours(vector_index, entry_candidates, vector_index.neighbour_limit);
+        int* new_link_count = nullptr;
+        int* new_links = access_hnsw_links(vector_index, new_node, layer_index, new_link_count);
+        for (int neighbour_node : chosen_neighbours) {
+            new_links[(*new_link_count)++] = neighbour_node;
+            int* neighbour_link_count = nullptr;
+            int* neighbour_links = access_hnsw_links(vector_index, neighbour_node, layer_index, neighbour_link_count);
+            if (*neighbour_link_count < layer_limit) {
+                neighbour_links[(*neighbour_link_count)++] = new_node;
+                continue;
+            }
+            const float* neighbour_vector = vector_index.stored_vectors.data() + size_t(neighbour_node) * vector_index.dimension;
+            float link_distances[65];
+            int link_nodes[65];
+            copy(neighbour_links, neighbour_links + layer_limit, link_nodes);
+            link_nodes[layer_limit] = new_node;
+            compute_batch_distances(neighbour_vector, vector_index.stored_vectors.data(), link_nodes, layer_limit + 1,
+                                    vector_index.dimension, link_distances);
+            vector<pair<float, int>> link_candidates;
+            for (int link_index = 0; link_index <= layer_limit; link_index++) {
+                link_candidates.push_back({link_distances[link_index], link_nodes[link_index]});
+            }
+            sort(link_candidates.begin(), link_candidates.end());
+            vector<int> kept_links = select_hnsw_neighbours(vector_index, link_candidates, layer_limit);
+            copy(kept_links.begin(), kept_links.end(), neighbour_links);
+            *neighbour_link_count = int(kept_links.size());
+        }
+    }
+    if (node_level > vector_index.top_level) {
+        vector_index.entry_point = new_node;
+        vector_index.top_level = node_level;
+    }
+    return new_node;                           // Function returns the identifier of the inserted vector
+}
+
+// Function declaration for k-nearest-neighbour search
+vector<pair<float, int>> search_hnsw_index(hnsw_index& vector_index, const float* query_vector, int neighbour_count, int search_breadth) {
+    if (vector_index.entry_point < 0) {
+        return {};
+    }
+    float entry_distance = 0.0f;
+    compute_batch_distances(query_vector, vector_index.stored_vectors.data(), &vector_index.entry_point, 1,
+                            vector_index.dimension, &entry_distance);
+    vector<pair<float, int>> entry_candidates = {{entry_distance, vector_index.entry_point}};
+    for (int layer_index = vector_index.top_level; layer_index > 0; layer_index--) {
+        entry_candidates = search_hnsw_layer(vector_index, query_vector, entry_candidates, 1, layer_index);
+    }
+    vector<pair<float, int>> nearest_neighbours = search_hnsw_layer(vector_index, query_vector, entry_candidates,
+                                                                    max(search_breadth, neighbour_count), 0);
+    nearest_neighbours.resize(min<size_t>(nearest_neighbours.size(), size_t(neighbour_count)));
+    return nearest_neighbours;                 // Function returns nearest neighbours with squared distances
+}
+
+// Waveform pyramid layout: base buckets of four sub-blocks, each higher level halving the resolution
+const int WAVEFORM_BASE_BUCKET_FRAMES = 4 * PROCESSING_SUB_BLOCK_SIZE; // Frames summarised by one base bucket
+const uint32_t WAVEFORM_SIDECAR_MAGIC = 0x59505741; // "AWPY" file signature
+const uint32_t WAVEFORM_SIDECAR_VERSION = 1;    // Sidecar layout revision
+const uint32_t WAVEFORM_MAXIMUM_LEVELS = 64;    // Levels accepted from a sidecar; 2^64 base buckets is unreachable
+
+// Structure definition for one quantised min/max/RMS summary (six bytes per channel)
+struct waveform_bucket {
+    int16_t minimum_level;                    // Lowest sample, rounded down to 1/32767
+    int16_t maximum_level;                    // Highest sample, rounded up to 1/32767
+    uint16_t rms_level;                       // Root mean square, scaled by 65535
+};
+
+// Structure definition for a multi-resolution waveform overview
+struct waveform_pyramid {
+    int channel_count;                        // Channels summarised per bucket
+    long long total_frames;                   // Frames covered by the pyramid
+    vector<vector<waveform_bucket>> level_buckets; // Buckets per level (bucket, channel)
+};
+
+// Structure definition for streaming pyramid construction state
+struct waveform_pyramid_builder {
+    waveform_pyramid pyramid;                 // Pyramid under construction
+    int partial_frames;                       // Frames accumulated into the open base bucket
+    vector<double> partial_minimum;           // Open bucket minimum per channel
+    vector<double> partial_maximum;           // Open bucket maximum per channel
+    vector<double> partial_square_sum;        // Open bucket sum of squares per channel
+    vector<int> span_lengths;                 // Bucket-aligned spans of the block being observed
+    vector<double> span_summaries;            // Minimum, maximum and square sum per (channel, span)
+};
+
+// Structure definition for one rendered overview column
+struct waveform_column {
+    double minimum_level;                     // Lowest sample under the pixel
+    double maximum_level;                     // Highest sample under the pixel
+    double rms_level;                         // RMS under the pixel
+};
+
+// Function declaration for pyramid builder initialization
+waveform_pyramid_builder initialize_waveform_pyramid(int channel_count) {
+    waveform_pyramid_builder pyramid_builder;  // Local builder structure instance
+    pyramid_builder.pyramid.channel_count = channel_count;
+    pyramid_builder.pyramid.total_frames = 0;
+    pyramid_builder.pyramid.level_buckets.resize(1);
+    pyramid_builder.partial_frames = 0;
+    pyramid_builder.partial_minimum.assign(channel_count, HUGE_VAL);
+    pyramid_builder.partial_maximum.assign(channel_count, -HUGE_VAL);
+    pyramid_builder.partial_square_sum.assign(channel_count, 0.0);
+    return pyramid_builder;                    // Function returns empty builder
+}
+
+// Function declaration for the frames one bucket covers, fewer than its span only at the end of the file
+long long waveform_bucket_frames(const waveform_pyramid& pyramid, size_t level_index, size_t bucket_index) {
+    long long bucket_span = (long long)(WAVEFORM_BASE_BUCKET_FRAMES) << level_index;
+    return max(0LL, min(bucket_span, pyramid.total_frames - (long long)(bucket_index) * bucket_span));
+}
+
+// Function declaration for merging two adjacent buckets, weighting RMS by the frames each covers
+waveform_bucket merge_waveform_buckets(const waveform_bucket& first_bucket, long long first_frames,
+                                       const waveform_bucket& second_bucket, long long second_frames) {
+    double first_rms = first_bucket.rms_level;
+    double second_rms = second_bucket.rms_level;
+    double merged_square = (first_frames * first_rms * first_rms + second_frames * second_rms * second_rms) /
+                           double(max(1LL, first_frames + second_frames));
+    return {min(first_bucket.minimum_level, second_bucket.minimum_level), max(first_bucket.maximum_level, second_bucket.maximum_level),
+            uint16_t(lround(sqrt(merged_square)))};
+}
+
+// Function declaration for closing the open base bucket and cascading completed pairs upward
+void emit_waveform_bucket(waveform_pyramid_builder& pyramid_builder) {
+    waveform_pyramid& pyramid = pyramid_builder.pyramid;
+    int channel_count = pyramid.channel_count;
+    for (int channel_index = 0; channel_index < channel_count; channel_index++) {
+        double bucket_rms = sqrt(pyramid_builder.partial_square_sum[channel_index] / max(1, pyramid_builder.partial_frames));
+        pyramid.level_buckets[0].push_back({
+            int16_t(clamp(floor(pyramid_builder.partial_minimum[channel_index] * 32767.0), -32767.0, 32767.0)),
+            int16_t(clamp(ceil(pyramid_builder.partial_maximum[channel_index] * 32767.0), -32767.0, 32767.0)),
+            uint16_t(clamp(lround(bucket_rms * 65535.0), 0L, 65535L))});
+        pyramid_builder.partial_minimum[channel_index] = HUGE_VAL;
+        pyramid_builder.partial_maximum[channel_index] = -HUGE_VAL;
+        pyramid_builder.partial_square_sum[channel_index] = 0.0;
+    }
+    pyramid_builder.partial_frames = 0;
+
+    // Every second bucket at a level completes a pair that becomes one bucket on the level above
+    for (size_t level_index = 0; (pyramid.level_buckets[level_index].size() / channel_count) % 2 == 0; level_index++) {
+        if (level_index + 1 == pyramid.level_buckets.size()) {
+            pyramid.level_buckets.emplace_back();
+        }
+        const vector<waveform_bucket>& lower_level = pyramid.level_buckets[level_index];
+        size_t pair_bucket = lower_level.size() / channel_count - 2;
+        long long first_frames = waveform_bucket_frames(pyramid, level_index, pair_bucket);
+        long long second_frames = waveform_bucket_frames(pyramid, level_index, pair_bucket + 1);
+        for (int channel_index = 0; channel_index < channel_count; channel_index++) {
+            pyramid.level_buckets[level_index + 1].push_back(
+                merge_waveform_buckets(lower_level[pair_bucket * channel_count + channel_index], first_frames,
+                                       lower_level[(pair_bucket + 1) * channel_count + channel_index], second_frames));
+        }
+    }
+}
+
+// Structure definition for an observing stage that summarises bucket-aligned spans of each channel plane
+struct waveform_pyramid_stage : fused_stage_marker {
+    waveform_pyramid_builder* pyramid_builder = nullptr; // Builder receiving the span summaries
+    size_t span_slot = 0;                     // Summary written when the current span closes
+    size_t span_in_plane = 0;                 // Position of the current span within its plane
+    int span_remaining = 0;                   // Samples left in the current span
+    double span_minimum = HUGE_VAL;           // Lowest sample in the current span
+    double span_maximum = -HUGE_VAL;          // Highest sample in the current span
+    double span_square_sum = 0.0;             // Sum of squared samples in the current span
+
+    double process_sample(double sample_value) {
+        span_minimum = sample_value < span_minimum ? sample_value : span_minimum;
+        span_maximum = sample_value > span_maximum ? sample_value : span_maximum;
+        span_square_sum += sample_value * sample_value;
+        if (--span_remaining == 0) {
+            close_span();
+        }
+        return sample_value;
+    }
+
+    // The system stores the finished span and restarts the spans at each new channel plane
+    void close_span() {
+        double* span_summary = pyramid_builder->span_summaries.data() + 3 * span_slot;
+        span_summary[0] = span_minimum;
+        span_summary[1] = span_maximum;
+        span_summary[2] = span_square_sum;
+        span_minimum = HUGE_VAL;
+        span_maximum = -HUGE_VAL;
+        span_square_sum = 0.0;
+        span_slot++;
+        span_in_plane = (span_in_plane + 1) % pyramid_builder->span_lengths.size();
+        span_remaining = pyramid_builder->span_lengths[span_in_plane];
+    }
+
+    // The system folds the spans into the open buckets in frame order, emitting each bucket once all channels are in
+    void finish_block() {
+        if (!pyramid_builder) {
+            return;
+        }
+        waveform_pyramid_builder& builder = *pyramid_builder;
+        size_t span_count = builder.span_lengths.size();
+        for (size_t span_index = 0; span_index < span_count; span_index++) {
+            for (int channel_index = 0; channel_index < builder.pyramid.channel_count; channel_index++) {
+                const double* span_summary = builder.span_summaries.data() + 3 * (size_t(channel_index) * span_count + span_index);
+                builder.partial_minimum[channel_index] = min(builder.partial_minimum[channel_index], span_summary[0]);
+                builder.partial_maximum[channel_index] = max(builder.partial_maximum[channel_index], span_summary[1]);
+                builder.partial_square_sum[channel_index] += span_summary[2];
+            }
+            builder.partial_frames += builder.span_lengths[span_index];
+            builder.pyramid.total_frames += builder.span_lengths[span_index];
+            if (builder.partial_frames == WAVEFORM_BASE_BUCKET_FRAMES) {
+                emit_waveform_bucket(builder);
+            }
+        }
+    }
+};
+
+// Function declaration for pyramid stage preparation over the bucket-aligned spans of the next block
+waveform_pyramid_stage prepare_waveform_pyramid_stage(waveform_pyramid_builder& pyramid_builder, int plane_frames) {
+    waveform_pyramid_stage pyramid_stage;      // Local stage instance
+    pyramid_builder.span_lengths.clear();
+    for (int span_start = 0; span_start < plane_frames;) {
+        int span_length = min(plane_frames - span_start,
+                              span_start == 0 ? WAVEFORM_BASE_BUCKET_FRAMES - pyramid_builder.partial_frames : WAVEFORM_BASE_BUCKET_FRAMES);
+        pyramid_builder.span_lengths.push_back(span_length);
+        span_start += span_length;
+    }
+    pyramid_builder.span_summaries.resize(3 * pyramid_builder.span_lengths.size() * size_t(pyramid_builder.pyramid.channel_count));
+    pyramid_stage.pyramid_builder = &pyramid_builder;
+    pyramid_stage.span_remaining = pyramid_builder.span_lengths.empty() ? 0 : pyramid_builder.span_lengths[0];
+    return pyramid_stage;                      // Function returns the stage positioned at the first span
+}
+
+// Function declaration for streaming pyramid construction over one planar block
+void feed_waveform_pyramid(waveform_pyramid_builder& pyramid_builder, const audio_processing_buffer& source_buffer) {
+    // The system observes only the planes the pyramid summarises
+    if (source_buffer.channel_count < pyramid_builder.pyramid.channel_count) {
+        return;
+    }
+    int plane_frames = frames_per_channel(source_buffer);
+    waveform_pyramid_stage pyramid_stage = prepare_waveform_pyramid_stage(pyramid_builder, plane_frames);
+    observe_fused_chain(pyramid_stage, source_buffer.sample_data_array.data(), plane_frames * pyramid_builder.pyramid.channel_count);
+}
+
+// Function declaration for peak and RMS level measurement with the pyramid stage composed into the same fused pass
+void measure_audio_buffer_levels(audio_processing_buffer& audio_buffer, waveform_pyramid_builder& pyramid_builder) {
+    // The system keeps two passes only when the pyramid would skip channels the level figures must include
+    if (audio_buffer.channel_count != pyramid_builder.pyramid.channel_count) {
+        measure_audio_buffer_levels(audio_buffer);
+        feed_waveform_pyramid(pyramid_builder, audio_buffer);
+        return;
+    }
+    peak_statistic_stage peak_statistic;
+    rms_statistic_stage rms_statistic;
+    mean_statistic_stage mean_statistic;
+    peak_statistic.peak_target = &audio_buffer.peak_amplitude_level;
+    rms_statistic.rms_target = &audio_buffer.rms_power_level;
+    mean_statistic.mean_target = &audio_buffer.dc_offset_level;
+    waveform_pyramid_stage pyramid_stage = prepare_waveform_pyramid_stage(pyramid_builder, frames_per_channel(audio_buffer));
+    auto measurement_chain = peak_statistic | rms_statistic | mean_statistic | pyramid_stage;
+    observe_fused_chain(measurement_chain, audio_buffer.sample_data_array.data(),
+                        int(audio_buffer.sample_data_array.size()));
+    audio_buffer.processed_sample_count = int(audio_buffer.sample_data_array.size());
+}
+
+// Function declaration for closing the pyramid so every level spans the whole file
+waveform_pyramid finalize_waveform_pyramid(waveform_pyramid_builder& pyramid_builder) {
+    if (pyramid_builder.partial_frames > 0) {
+        emit_waveform_bucket(pyramid_builder);
+    }
+
+    // The system closes each level's trailing parent, merging a final pair or carrying a lone bucket whose span
+    // already equals the parent's, until a single bucket covers everything
+    waveform_pyramid& pyramid = pyramid_builder.pyramid;
+    int channel_count = pyramid.channel_count;
+    for (size_t level_index = 0; pyramid.level_buckets[level_index].size() > size_t(channel_count); level_index++) {
+        if (level_index + 1 == pyramid.level_buckets.size()) {
+            pyramid.level_buckets.emplace_back();
+        }
+        const vector<waveform_bucket>& lower_level = pyramid.level_buckets[level_index];
+        vector<waveform_bucket>& upper_level = pyramid.level_buckets[level_index + 1];
+        size_t lower_count = lower_level.size() / channel_count;
+        if (upper_level.size() / channel_count == (lower_count + 1) / 2) {
+            continue;
+        }
+        if (lower_count % 2 == 1) {
+            upper_level.insert(upper_level.end(), lower_level.end() - channel_count, lower_level.end());
+            continue;
+        }
+        long long first_frames = waveform_bucket_frames(pyramid, level_index, lower_count - 2);
+        long long second_frames = waveform_bucket_frames(pyramid, level_index, lower_count - 1);
+        for (int channel_index = 0; channel_index < channel_count; channel_index++) {
+            upper_level.push_back(merge_waveform_buckets(lower_level[(lower_count - 2) * channel_count + channel_index], first_frames,
+                                                         lower_level[(lower_count - 1) * channel_count + channel_index], second_frames));
+        }
+    }
+    return pyramid;                            // Function returns the completed pyramid
+}
+
+// Function declaration for zoomed overview rendering in time proportional to the pixel count
+vector<waveform_column> render_waveform_overview(const waveform_pyramid& pyramid, int channel_index, long long first_frame,
+                                                 long long frame_count, int pixel_count) {
+    vector<waveform_column> overview_columns(max(0, pixel_count), {0.0, 0.0, 0.0});
+    // The system returns empty columns for a channel the pyramid does not hold
+    if (channel_index < 0 || channel_index >= pyramid.channel_count) {
+        return overview_columns;
+    }
+    if (pixel_count <= 0 || frame_count <= 0 || pyramid.level_buckets.empty() || pyramid.level_buckets[0].empty()) {
+        return overview_columns;
+    }
+
+    // The system picks the coarsest level whose buckets still fit inside one pixel
+    double frames_per_pixel = double(frame_count) / pixel_count;
+    size_t level_index = 0;
+    while (level_index + 1 < pyramid.level_buckets.size() &&
+           double(WAVEFORM_BASE_BUCKET_FRAMES << (level_index + 1)) <= frames_per_pixel) {
+        level_index++;
+    }
+    long long bucket_frames = (long long)(WAVEFORM_BASE_BUCKET_FRAMES) << level_index;
+    const vector<waveform_bucket>& level_buckets = pyramid.level_buckets[level_index];
+    long long level_bucket_count = (long long)(level_buckets.size() / pyramid.channel_count);
+
+    for (int pixel_index = 0; pixel_index < pixel_count; pixel_index++) {
+        long long pixel_start = first_frame + (long long)(pixel_index * frames_per_pixel);
+        long long pixel_end = max(pixel_start + 1, first_frame + (long long)((pixel_index + 1) * frames_per_pixel));
+        long long first_bucket = max(0LL, pixel_start / bucket_frames);
+        long long end_bucket = min(level_bucket_count, (pixel_end + bucket_frames - 1) / bucket_frames);
+        int minimum_code = 32767, maximum_code = -32767;
+        double square_total = 0.0;
+        long long covered_frames = 0;
+        for (long long bucket_index = first_bucket; bucket_index < end_bucket; bucket_index++) {
+            const waveform_bucket& summary_bucket = level_buckets[size_t(bucket_index) * pyramid.channel_count + channel_index];
+            long long bucket_weight = bucket_index + 1 < level_bucket_count ? bucket_frames :
+                                      waveform_bucket_frames(pyramid, level_index, size_t(bucket_index));
+            minimum_code = min<int>(minimum_code, summary_bucket.minimum_level);
+            maximum_code = max<int>(maximum_code, summary_bucket.maximum_level);
+            square_total += bucket_weight * double(summary_bucket.rms_level) * summary_bucket.rms_level;
+            covered_frames += bucket_weight;
+        }
+        if (end_bucket > first_bucket) {
+            overview_columns[pixel_index] = {minimum_code / 32767.0, maximum_code / 32767.0,
+                                             sqrt(square_total / double(max(1LL, covered_frames))) / 65535.0};
+        }
+    }
+    return overview_columns;                   // Function returns one column per pixel
+}
+
+// Function declaration for compact pyramid sidecar storage
+bool write_waveform_sidecar(const waveform_pyramid& pyramid, const string& sidecar_path) {
+    ofstream sidecar_stream(sidecar_path, ios::binary | ios::trunc);
+    if (!sidecar_stream) {
+        return false;
+    }
+    uint32_t header_words[5] = {WAVEFORM_SIDECAR_MAGIC, WAVEFORM_SIDECAR_VERSION, uint32_t(pyramid.channel_count),
+                                uint32_t(WAVEFORM_BASE_BUCKET_FRAMES), uint32_t(pyramid.level_buckets.size())};
+    int64_t total_frames = pyramid.total_frames;
+    sidecar_stream.write(reinterpret_cast<const char*>(header_words), sizeof(header_words));
+    sidecar_stream.write(reinterpret_cast<const char*>(&total_frames), sizeof(total_frames));
+    for (const vector<waveform_bucket>& level_buckets : pyramid.level_buckets) {
+        uint64_t bucket_total = level_buckets.size();
+        sidecar_stream.write(reinterpret_cast<const char*>(&bucket_total), sizeof(bucket_total));
+        sidecar_stream.write(reinterpret_cast<const char*>(level_buckets.data()), streamsize(bucket_total * sizeof(waveform_bucket)));
+    }
+    return bool(sidecar_stream);               // Function returns whether every write succeeded
+}
+
+// Function declaration for pyramid sidecar loading with header and level-size validation
+bool read_waveform_sidecar(const string& sidecar_path, waveform_pyramid& pyramid) {
+    ifstream sidecar_stream(sidecar_path, ios::binary | ios::ate);
+    long long file_bytes = sidecar_stream ? (long long)(sidecar_stream.tellg()) : 0;
+    sidecar_stream.seekg(0);
+    uint32_t header_words[5] = {0, 0, 0, 0, 0};
+    int64_t total_frames = 0;
+    sidecar_stream.read(reinterpret_cast<char*>(header_words), sizeof(header_words));
+    sidecar_stream.read(reinterpret_cast<char*>(&total_frames), sizeof(total_frames));
+    if (!sidecar_stream || header_words[0] != WAVEFORM_SIDECAR_MAGIC || header_words[1] != WAVEFORM_SIDECAR_VERSION ||
+        header_words[3] != uint32_t(WAVEFORM_BASE_BUCKET_FRAMES) || header_words[2] == 0 || header_words[2] > 0x7fffffffu ||
+        header_words[4] == 0 || header_words[4] > WAVEFORM_MAXIMUM_LEVELS || total_frames < 0) {
+        return false;
+    }
+    pyramid.channel_count = int(header_words[2]);
+    pyramid.total_frames = total_frames;
+    pyramid.level_buckets.assign(header_words[4], vector<waveform_bucket>());
+
+    // The system derives every level's size from the frame count and rejects any level the file cannot hold
+    uint64_t expected_buckets = (uint64_t(total_frames) + WAVEFORM_BASE_BUCKET_FRAMES - 1) / WAVEFORM_BASE_BUCKET_FRAMES;
+    for (size_t level_index = 0; level_index < pyramid.level_buckets.size(); level_index++) {
+        if (level_index > 0 && expected_buckets <= 1) {
+            return false;
+        }
+        if (level_index > 0) {
+            expected_buckets = (expected_buckets + 1) / 2;
+        }
+        uint64_t bucket_total = 0;
+        sidecar_stream.read(reinterpret_cast<char*>(&bucket_total), sizeof(bucket_total));
+        long long remaining_bytes = file_bytes - (long long)(sidecar_stream.tellg());
+        if (!sidecar_stream || remaining_bytes < 0 ||
+            expected_buckets > uint64_t(remaining_bytes) / sizeof(waveform_bucket) / uint64_t(pyramid.channel_count) ||
+            bucket_total != expected_buckets * uint64_t(pyramid.channel_count)) {
+            return false;
+        }
+        vector<waveform_bucket>& level_buckets = pyramid.level_buckets[level_index];
+        level_buckets.resize(size_t(bucket_total));
+        sidecar_stream.read(reinterpret_cast<char*>(level_buckets.data()), streamsize(bucket_total * sizeof(waveform_bucket)));
+    }
+    return bool(sidecar_stream) && expected_buckets <= 1; // Function returns whether the sidecar was complete and consistent
+}
+
+// Analysis cache identifiers; bump the analyzer version whenever any cached analysis changes its output
+const uint32_t ANALYSIS_CACHE_MAGIC = 0x43524141; // "AARC" file signature
+const uint32_t ANALYSIS_CACHE_VERSION = 1;     // Analyzer version embedded in every cache key
+const int CONTENT_HASH_LANES = 8;              // Independent 64-bit accumulators per 64-byte stripe
+
+// Structure definition for one cached analysis result
+struct analysis_cache_record {
+    uint64_t content_hash;                    // Hash of the decoded samples and channel layout
+    uint32_t analyzer_version;                // Analyzer version that produced the record
+    double peak_amplitude_level;              // Cached buffer peak
+    double rms_power_level;                   // Cached buffer RMS
+    double dc_offset_level;                   // Cached buffer mean
+    int processed_sample_count;               // Cached sample count
+    int channel_count;                        // Cached channel count
+    vector<double> extended_features;         // Additional analyzer outputs (track embedding)
+};
+
+// Function declaration for 64-bit left rotation
+inline uint64_t rotate_hash_word(uint64_t hash_word, int rotation_bits) {
+    return (hash_word << rotation_bits) | (hash_word >> (64 - rotation_bits));
+}
+
+// Function declaration for one multiply-rotate accumulation round
+inline uint64_t mix_hash_round(uint64_t accumulator, uint64_t input_word) {
+    return rotate_hash_word(accumulator + input_word * 0xC2B2AE3D27D4EB4FULL, 31) * 0x9E3779B185EBCA87ULL;
+}
+
+// Function declaration for lane-parallel non-cryptographic content hashing
+uint64_t compute_content_hash(const uint8_t* source_bytes, size_t byte_count, uint64_t seed_value = 0) {
+    const uint64_t PRIME_ONE = 0x9E3779B185EBCA87ULL;
+    const uint64_t PRIME_TWO = 0xC2B2AE3D27D4EB4FULL;
+    const uint64_t PRIME_THREE = 0x165667B19E3779F9ULL;
+    const uint64_t PRIME_FOUR = 0x85EBCA77C2B2AE63ULL;
+    const uint64_t PRIME_FIVE = 0x27D4EB2F165667C5ULL;
+
+    // The system feeds eight independent accumulators per stripe so the multiplies overlap instead of chaining
+    uint64_t lane_accumulator[CONTENT_HASH_LANES];
+    for (int lane_index = 0; lane_index < CONTENT_HASH_LANES; lane_index++) {
+        lane_accumulator[lane_index] = seed_value + PRIME_TWO + uint64_t(lane_index) * PRIME_ONE;
+    }
+    const size_t stripe_bytes = sizeof(uint64_t) * CONTENT_HASH_LANES;
+    size_t stripe_end = byte_count - byte_count % stripe_bytes;
+    for (size_t byte_offset = 0; byte_offset < stripe_end; byte_offset += stripe_bytes) {
+        uint64_t stripe_words[CONTENT_HASH_LANES];
+        memcpy(stripe_words, source_bytes + byte_offset, stripe_bytes);
+        for (int lane_index = 0; lane_index < CONTENT_HASH_LANES; lane_index++) {
+            lane_accumulator[lane_index] = mix_hash_round(lane_accumulator[lane_index], stripe_words[lane_index]);
+        }
+    }
+
+    // The system folds the lanes, then the tail words and bytes, then avalanches the result
+    uint64_t hash_value = byte_count * PRIME_FIVE;
+    for (int lane_index = 0; lane_index < CONTENT_HASH_LANES; lane_index++) {
+        hash_value += rotate_hash_word(lane_accumulator[lane_index], 7 * lane_index + 1);
+    }
+    for (int lane_index = 0; lane_index < CONTENT_HASH_LANES; lane_index++) {
+        hash_value = (hash_value ^ mix_hash_round(0, lane_accumulator[lane_index])) * PRIME_ONE + PRIME_FOUR;
+    }
+    size_t byte_offset = stripe_end;
+    for (; byte_offset + sizeof(uint64_t) <= byte_count; byte_offset += sizeof(uint64_t)) {
+        uint64_t tail_word = 0;
+        memcpy(&tail_word, source_bytes + byte_offset, sizeof(tail_word));
+        hash_value = rotate_hash_word(hash_value ^ mix_hash_round(0, tail_word), 27) * PRIME_ONE + PRIME_FOUR;
+    }
+    for (; byte_offset < byte_count; byte_offset++) {
+        hash_value = rotate_hash_word(hash_value ^ (source_bytes[byte_offset] * PRIME_FIVE), 11) * PRIME_ONE;
+    }
+    hash_value ^= hash_value >> 33;
+    hash_value *= PRIME_TWO;
+    hash_value ^= hash_value >> 29;
+    hash_value *= PRIME_THREE;
+    hash_value ^= hash_value >> 32;
+    return hash_value;                         // Function returns the 64-bit content hash
+}
+
+// Function declaration for decoded audio hashing including the channel layout
+uint64_t hash_audio_buffer(const audio_processing_buffer& audio_buffer) {
+    return compute_content_hash(reinterpret_cast<const uint8_t*>(audio_buffer.sample_data_array.data()),
+                                audio_buffer.sample_data_array.size() * sizeof(double), uint64_t(audio_buffer.channel_count));
+}
+
+// Function declaration for cache entry location from content hash and analyzer version
+string analysis_cache_entry_path(const string& cache_directory, uint64_t content_hash) {
+    char entry_name[48];
+    snprintf(entry_name, sizeof(entry_name), "%016llx-v%u.aarc", (unsigned long long)content_hash, ANALYSIS_CACHE_VERSION);
+    return (filesystem::path(cache_directory) / entry_name).string();
+}
+
+// Function declaration for cache record storage
+bool store_cached_analysis(const string& cache_directory, const analysis_cache_record& cache_record) {
+    error_code directory_error;
+    filesystem::create_directories(cache_directory, directory_error);
+    ofstream record_stream(analysis_cache_entry_path(cache_directory, cache_record.content_hash), ios::binary | ios::trunc);
+    if (!record_stream) {
+        return false;
+    }
+    uint32_t header_words[2] = {ANALYSIS_CACHE_MAGIC, cache_record.analyzer_version};
+    double summary_levels[3] = {cache_record.peak_amplitude_level, cache_record.rms_power_level, cache_record.dc_offset_level};
+    int32_t summary_counts[3] = {cache_record.processed_sample_count, cache_record.channel_count, int32_t(cache_record.extended_features.size())};
+    record_stream.write(reinterpret_cast<const char*>(header_words), sizeof(header_words));
+    record_stream.write(reinterpret_cast<const char*>(&cache_record.content_hash), sizeof(cache_record.content_hash));
+    record_stream.write(reinterpret_cast<const char*>(summary_levels), sizeof(summary_levels));
+    record_stream.write(reinterpret_cast<const char*>(summary_counts), sizeof(summary_counts));
+    record_stream.write(reinterpret_cast<const char*>(cache_record.extended_features.data()),
+                        streamsize(cache_record.extended_features.size() * sizeof(double)));
+    return bool(record_stream);                // Function returns whether every write succeeded
+}
+
+// Function declaration for cache record lookup with signature, version and hash validation
+bool load_cached_analysis(const string& cache_directory, uint64_t content_hash, analysis_cache_record& cache_record) {
+    ifstream record_stream(analysis_cache_entry_path(cache_directory, content_hash), ios::binary | ios::ate);
+    if (!record_stream) {
+        return false;
+    }
+    long long record_bytes = (long long)(record_stream.tellg());
+    record_stream.seekg(0);
+    uint32_t header_words[2] = {0, 0};
+    double summary_levels[3] = {0.0, 0.0, 0.0};
+    int32_t summary_counts[3] = {0, 0, 0};
+    record_stream.read(reinterpret_cast<char*>(header_words), sizeof(header_words));
+    record_stream.read(reinterpret_cast<char*>(&cache_record.content_hash), sizeof(cache_record.content_hash));
+    record_stream.read(reinterpret_cast<char*>(summary_levels), sizeof(summary_levels));
+    record_stream.read(reinterpret_cast<char*>(summary_counts), sizeof(summary_counts));
+    if (!record_stream || header_words[0] != ANALYSIS_CACHE_MAGIC || header_words[1] != ANALYSIS_CACHE_VERSION ||
+        cache_record.content_hash != content_hash || summary_counts[2] < 0) {
+        return false;
+    }
+
+    // The system treats a feature count the record cannot hold, or no analysis produces, as a miss
+    long long remaining_bytes = record_bytes - (long long)(record_stream.tellg());
+    if (summary_counts[2] > TRACK_EMBEDDING_DIMENSION || (long long)(summary_counts[2]) * (long long)(sizeof(double)) != remaining_bytes) {
+        return false;
+    }
+    cache_record.analyzer_version = header_words[1];
+    cache_record.peak_amplitude_level = summary_levels[0];
+    cache_record.rms_power_level = summary_levels[1];
+    cache_record.dc_offset_level = summary_levels[2];
+    cache_record.processed_sample_count = summary_counts[0];
+    cache_record.channel_count = summary_counts[1];
+    cache_record.extended_features.resize(size_t(summary_counts[2]));
+    record_stream.read(reinterpret_cast<char*>(cache_record.extended_features.data()),
+                       streamsize(cache_record.extended_features.size() * sizeof(double)));
+    return bool(record_stream);                // Function returns whether the record was complete
+}
+
+// Function declaration for cached buffer analysis that only hashes when the content is unchanged
+analysis_cache_record analyse_buffer_with_cache(const string& cache_directory, audio_processing_buffer& audio_buffer, bool& cache_hit) {
+    analysis_cache_record cache_record;        // Local record structure instance
+    uint64_t content_hash = hash_audio_buffer(audio_buffer);
+    cache_hit = load_cached_analysis(cache_directory, content_hash, cache_record);
+
+    if (!cache_hit) {
+        // The system runs the level pass and the embedding accumulator, then persists both
+        measure_audio_buffer_levels(audio_buffer);
+        track_embedding_state embedding_state = initialize_track_embedding();
+        feed_track_embedding(embedding_state, audio_buffer);
+        vector<float> track_embedding = finalize_track_embedding(embedding_state);
+        cache_record = {content_hash, ANALYSIS_CACHE_VERSION, audio_buffer.peak_amplitude_level, audio_buffer.rms_power_level,
+                        audio_buffer.dc_offset_level, audio_buffer.processed_sample_count, audio_buffer.channel_count,
+                        vector<double>(track_embedding.begin(), track_embedding.end())};
+        store_cached_analysis(cache_directory, cache_record);
+    }
+
+    // The system restores the buffer summary from the record on both paths
+    audio_buffer.peak_amplitude_level = cache_record.peak_amplitude_level;
+    audio_buffer.rms_power_level = cache_record.rms_power_level;
+    audio_buffer.dc_offset_level = cache_record.dc_offset_level;
+    audio_buffer.processed_sample_count = cache_record.processed_sample_count;
+    return cache_record;                       // Function returns the cached or fresh analysis
+}
+
+// Incremental analysis layout: chunk size matches the streamed PCM readers
+const int INCREMENTAL_CHUNK_FRAMES = AUDIO_BUFFER_SIZE * 64; // Frames per independently hashed chunk
+const uint32_t INCREMENTAL_MANIFEST_MAGIC = 0x434E4941; // "AINC" file signature
+const uint32_t INCREMENTAL_MANIFEST_VERSION = 1; // Manifest layout revision
+
+// Enumeration of change detection strategies for incremental re-analysis
+enum incremental_scan_mode {
+    SCAN_APPENDED_ONLY,                       // Trust complete recorded chunks and read only the tail
+    SCAN_VERIFY_ALL                           // Hash every chunk and re-analyse any that changed
+};
+
+// Structure definition for mergeable per-chunk statistics (fixed size, stored verbatim)
+struct chunk_partial_statistics {
+    uint64_t chunk_hash;                      // Content hash of the chunk's stored bytes
+    int64_t frame_count;                      // Frames in the chunk
+    double peak_level;                        // Absolute peak over all channels
+    double square_sum;                        // Sum of squared samples over all channels
+    double sample_sum;                        // Sum of samples over all channels
+    double cepstrum_sum[MFCC_COEFFICIENT_COUNT];        // Embedding accumulator MFCC sums
+    double cepstrum_square_sum[MFCC_COEFFICIENT_COUNT]; // Embedding accumulator MFCC squared sums
+    double shape_sums[5];                     // Centroid, rolloff, flatness, loudness and loudness squared sums
+    int64_t active_frame_count;               // Embedding frames above the silence floor
+};
+
+// Structure definition for the persisted per-file chunk manifest
+struct incremental_analysis_manifest {
+    int channel_count;                        // Channels in the analysed file
+    vector<chunk_partial_statistics> chunk_statistics; // Statistics per chunk in file order
+};
+
+// Structure definition for merged file-level results of an incremental pass
+struct incremental_analysis_report {
+    int reused_chunks;                        // Chunks merged from the manifest unchanged
+    int analysed_chunks;                      // Chunks read and analysed in this pass
+    double peak_amplitude_level;              // File peak
+    double rms_power_level;                   // File RMS
+    double dc_offset_level;                   // File mean
+    vector<float> track_embedding;            // File embedding from merged accumulator sums
+};
+
+// Function declaration for analysis of one planar chunk into mergeable statistics
+chunk_partial_statistics analyse_audio_chunk(audio_processing_buffer& chunk_buffer, uint64_t chunk_hash) {
+    chunk_partial_statistics chunk_statistics = {}; // Local statistics instance with zeroed sums
+    measure_audio_buffer_levels(chunk_buffer);
+    double sample_total = double(chunk_buffer.sample_data_array.size());
+    chunk_statistics.chunk_hash = chunk_hash;
+    chunk_statistics.frame_count = frames_per_channel(chunk_buffer);
+    chunk_statistics.peak_level = chunk_buffer.peak_amplitude_level;
+    chunk_statistics.square_sum = chunk_buffer.rms_power_level * chunk_buffer.rms_power_level * sample_total;
+    chunk_statistics.sample_sum = chunk_buffer.dc_offset_level * sample_total;
+
+    // Embedding frames restart at each chunk so a chunk's sums never depend on its neighbours
+    track_embedding_state embedding_state = initialize_track_embedding();
+    feed_track_embedding(embedding_state, chunk_buffer);
+    copy(embedding_state.cepstrum_sum, embedding_state.cepstrum_sum + MFCC_COEFFICIENT_COUNT, chunk_statistics.cepstrum_sum);
+    copy(embedding_state.cepstrum_square_sum, embedding_state.cepstrum_square_sum + MFCC_COEFFICIENT_COUNT,
+         chunk_statistics.cepstrum_square_sum);
+    chunk_statistics.shape_sums[0] = embedding_state.centroid_sum;
+    chunk_statistics.shape_sums[1] = embedding_state.rolloff_sum;
+    chunk_statistics.shape_sums[2] = embedding_state.flatness_sum;
+    chunk_statistics.shape_sums[3] = embedding_state.loudness_sum;
+    chunk_statistics.shape_sums[4] = embedding_state.loudness_square_sum;
+    chunk_statistics.active_frame_count = embedding_state.active_frame_count;
+    return chunk_statistics;                   // Function returns mergeable chunk statistics
+}
+
+// Function declaration for incremental re-analysis of an interleaved float PCM file against its manifest
+incremental_analysis_report reanalyse_pcm_file_incrementally(const string& file_path, int channel_count,
+                                                             incremental_analysis_manifest& manifest, incremental_scan_mode scan_mode) {
+    incremental_analysis_report analysis_report = {0, 0, 0.0, 0.0, 0.0, {}};
+    if (manifest.channel_count != channel_count) {
+        manifest.channel_count = channel_count;
+        manifest.chunk_statistics.clear();
+    }
+    size_t frame_bytes = sizeof(float) * size_t(channel_count);
+    size_t chunk_bytes = frame_bytes * INCREMENTAL_CHUNK_FRAMES;
+    error_code size_error;
+    uint64_t file_bytes = filesystem::file_size(file_path, size_error);
+    size_t chunk_total = size_error ? 0 : size_t((file_bytes / frame_bytes + INCREMENTAL_CHUNK_FRAMES - 1) / INCREMENTAL_CHUNK_FRAMES);
+
+    // In append mode the system starts reading at the first chunk the manifest does not hold complete
+    size_t first_read_chunk = 0;
+    if (scan_mode == SCAN_APPENDED_ONLY) {
+        while (first_read_chunk < min(chunk_total, manifest.chunk_statistics.size()) &&
+               manifest.chunk_statistics[first_read_chunk].frame_count == INCREMENTAL_CHUNK_FRAMES) {
+            first_read_chunk++;
+        }
+    }
+    manifest.chunk_statistics.resize(min(manifest.chunk_statistics.size(), chunk_total));
+
+    vector<uint8_t> interleaved_chunk(chunk_bytes);
+    audio_processing_buffer planar_chunk = {vector<double>(), 0.0, 0.0, 0, channel_count, 0.0};
+    ifstream pcm_stream(file_path, ios::binary);
+    pcm_stream.seekg(streamoff(first_read_chunk * chunk_bytes));
+    for (size_t chunk_index = first_read_chunk; chunk_index < chunk_total && pcm_stream; chunk_index++) {
+        pcm_stream.read(reinterpret_cast<char*>(interleaved_chunk.data()), streamsize(chunk_bytes));
+        int frames_read = int(size_t(pcm_stream.gcount()) / frame_bytes);
+        if (frames_read == 0) {
+            break;
+        }
+
+        // The system hashes the stored bytes and re-analyses only chunks whose hash or length changed
+        uint64_t chunk_hash = compute_content_hash(interleaved_chunk.data(), size_t(frames_read) * frame_bytes, uint64_t(channel_count));
+        if (chunk_index < manifest.chunk_statistics.size() && manifest.chunk_statistics[chunk_index].chunk_hash == chunk_hash &&
+            manifest.chunk_statistics[chunk_index].frame_count == frames_read) {
+            continue;
+        }
+        import_samples_to_buffer(interleaved_chunk.data(), SAMPLE_FORMAT_FLOAT32, frames_read, channel_count, true, planar_chunk);
+        chunk_partial_statistics chunk_statistics = analyse_audio_chunk(planar_chunk, chunk_hash);
+        if (chunk_index < manifest.chunk_statistics.size()) {
+            manifest.chunk_statistics[chunk_index] = chunk_statistics;
+        } else {
+            manifest.chunk_statistics.push_back(chunk_statistics);
+        }
+        analysis_report.analysed_chunks++;
+    }
+    analysis_report.reused_chunks = int(manifest.chunk_statistics.size()) - analysis_report.analysed_chunks;
+
+    // The system merges every chunk's partial statistics into the file-level summary
+    track_embedding_state merged_embedding = initialize_track_embedding();
+    double square_total = 0.0;
+    double sample_total = 0.0;
+    double sample_count = 0.0;
+    for (const chunk_partial_statistics& chunk_statistics : manifest.chunk_statistics) {
+        analysis_report.peak_amplitude_level = max(analysis_report.peak_amplitude_level, chunk_statistics.peak_level);
+        square_total += chunk_statistics.square_sum;
+        sample_total += chunk_statistics.sample_sum;
+        sample_count += double(chunk_statistics.frame_count) * channel_count;
+        for (int coefficient_index = 0; coefficient_index < MFCC_COEFFICIENT_COUNT; coefficient_index++) {
+            merged_embedding.cepstrum_sum[coefficient_index] += chunk_statistics.cepstrum_sum[coefficient_index];
+            merged_embedding.cepstrum_square_sum[coefficient_index] += chunk_statistics.cepstrum_square_sum[coefficient_index];
+        }
+        merged_embedding.centroid_sum += chunk_statistics.shape_sums[0];
+        merged_embedding.rolloff_sum += chunk_statistics.shape_sums[1];
+        merged_embedding.flatness_sum += chunk_statistics.shape_sums[2];
+        merged_embedding.loudness_sum += chunk_statistics.shape_sums[3];
+        merged_embedding.loudness_square_sum += chunk_statistics.shape_sums[4];
+        merged_embedding.active_frame_count += chunk_statistics.active_frame_count;
+    }
+    analysis_report.rms_power_level = sample_count > 0.0 ? sqrt(square_total / sample_count) : 0.0;
+    analysis_report.dc_offset_level = sample_count > 0.0 ? sample_total / sample_count : 0.0;
+    analysis_report.track_embedding = finalize_track_embedding(merged_embedding);
+    return analysis_report;                    // Function returns merged file-level results
+}
+
+// Function declaration for manifest persistence
+bool write_incremental_manifest(const incremental_analysis_manifest& manifest, const string& manifest_path) {
+    ofstream manifest_stream(manifest_path, ios::binary | ios::trunc);
+    if (!manifest_stream) {
+        return false;
+    }
+    uint32_t header_words[5] = {INCREMENTAL_MANIFEST_MAGIC, INCREMENTAL_MANIFEST_VERSION, ANALYSIS_CACHE_VERSION,
+                                uint32_t(manifest.channel_count), uint32_t(INCREMENTAL_CHUNK_FRAMES)};
+    uint64_t chunk_total = manifest.chunk_statistics.size();
+    manifest_stream.write(reinterpret_cast<const char*>(header_words), sizeof(header_words));
+    manifest_stream.write(reinterpret_cast<const char*>(&chunk_total), sizeof(chunk_total));
+    manifest_stream.write(reinterpret_cast<const char*>(manifest.chunk_statistics.data()),
+                          streamsize(chunk_total * sizeof(chunk_partial_statistics)));
+    return bool(manifest_stream);              // Function returns whether every write succeeded
+}
+
+// Function declaration for manifest loading; any layout or analyzer mismatch yields an empty manifest
+incremental_analysis_manifest read_incremental_manifest(const string& manifest_path) {
+    incremental_analysis_manifest manifest = {0, {}};
+    ifstream manifest_stream(manifest_path, ios::binary | ios::ate);
+    long long manifest_bytes = manifest_stream ? (long long)(manifest_stream.tellg()) : 0;
+    manifest_stream.seekg(0);
+    uint32_t header_words[5] = {0, 0, 0, 0, 0};
+    uint64_t chunk_total = 0;
+    manifest_stream.read(reinterpret_cast<char*>(header_words), sizeof(header_words));
+    manifest_stream.read(reinterpret_cast<char*>(&chunk_total), sizeof(chunk_total));
+    if (!manifest_stream || header_words[0] != INCREMENTAL_MANIFEST_MAGIC || header_words[1] != INCREMENTAL_MANIFEST_VERSION ||
+        header_words[2] != ANALYSIS_CACHE_VERSION || header_words[4] != uint32_t(INCREMENTAL_CHUNK_FRAMES)) {
+        return manifest;
+    }
+
+    // The system loads nothing when the chunk count disagrees with the bytes the file actually holds
+    long long remaining_bytes = manifest_bytes - (long long)(manifest_stream.tellg());
+    if (remaining_bytes < 0 || uint64_t(remaining_bytes) % sizeof(chunk_partial_statistics) != 0 ||
+        chunk_total != uint64_t(remaining_bytes) / sizeof(chunk_partial_statistics)) {
+        return manifest;
+    }
+    manifest.channel_count = int(header_words[3]);
+    manifest.chunk_statistics.resize(size_t(chunk_total));
+    manifest_stream.read(reinterpret_cast<char*>(manifest.chunk_statistics.data()),
+                         streamsize(chunk_total * sizeof(chunk_partial_statistics)));
+    if (!manifest_stream) {
+        manifest.chunk_statistics.clear();
+    }
+    return manifest;                           // Function returns the loaded or empty manifest
+}
+
+// Columnar feature store layout constants
+const uint32_t FEATURE_STORE_MAGIC = 0x53434641; // "AFCS" file signature
+const uint32_t FEATURE_STORE_VERSION = 1;       // Store layout revision
+const int FEATURE_STORE_CHUNK_VALUES = 4096;    // Maximum values of one column per encoded chunk
+
+// Structure definition for one feature column; a zero quantisation step selects lossless float XOR coding
+struct feature_column_schema {
+    string column_name;                       // Column identifier used by scans
+    double quantisation_step;                 // Delta-varint step size, or 0.0 for float XOR coding
+};
+
+// Structure definition for one footer index entry (fixed size, stored verbatim)
+struct feature_chunk_descriptor {
+    uint32_t column_index;                    // Column the chunk belongs to
+    uint32_t track_identifier;                // Track the values were extracted from
+    uint32_t first_frame;                     // Frame index of the first value within the track
+    uint32_t value_count;                     // Values encoded in the chunk
+    uint64_t byte_offset;                     // Position of the encoded bytes in the file
+    uint64_t byte_length;                     // Encoded size in bytes
+    float minimum_value;                      // Smallest decoded value, used to skip chunks in range scans
+    float maximum_value;                      // Largest decoded value
+};
+
+// Structure definition for a streaming store writer holding at most one pending chunk per column
+struct feature_store_writer {
+    ofstream store_stream;                    // Output file
+    vector<feature_column_schema> column_schema; // Column definitions in frame order
+    vector<vector<float>> pending_values;     // Unflushed values per column
+    vector<feature_chunk_descriptor> chunk_index; // Footer entries for every flushed chunk
+    vector<uint8_t> encode_scratch;           // Reused encoded chunk bytes
+    uint32_t current_track;                   // Track receiving appended frames
+    uint32_t current_frame;                   // Frames appended to the current track
+    uint64_t write_position;                  // Bytes written so far
+};
+
+// Structure definition for an opened store: memory mapped where available, stream reads otherwise
+struct feature_store_reader {
+    const uint8_t* mapped_bytes;              // Whole-file mapping, or null when reading through the stream
+    size_t mapped_length;                     // Mapping length in bytes
+    ifstream fallback_stream;                 // Stream used when the file is not mapped
+    vector<uint8_t> read_scratch;             // Chunk bytes for stream reads
+    vector<float> decode_scratch;             // Decoded values handed to scan visitors
+    vector<feature_column_schema> column_schema; // Column definitions from the footer
+    vector<feature_chunk_descriptor> chunk_index; // Footer entries ordered by column, track and frame
+    bool store_ready;                         // Whether the footer was read and validated
+};
+
+// Function declaration for LEB128 varint emission
+void append_varint(vector<uint8_t>& encoded_bytes, uint64_t encoded_value) {
+    while (encoded_value >= 0x80) {
+        encoded_bytes.push_back(uint8_t(encoded_value | 0x80));
+        encoded_value >>= 7;
+    }
+    encoded_bytes.push_back(uint8_t(encoded_value));
+}
+
+// Function declaration for bounds-checked LEB128 varint decoding
+bool read_varint(const uint8_t*& read_cursor, const uint8_t* read_end, uint64_t& decoded_value) {
+    decoded_value = 0;
+    for (int shift_bits = 0; shift_bits < 64 && read_cursor < read_end; shift_bits += 7) {
+        uint8_t encoded_byte = *read_cursor++;
+        decoded_value |= uint64_t(encoded_byte & 0x7F) << shift_bits;
+        if (!(encoded_byte & 0x80)) {
+            return true;
+        }
+    }
+    return false;                              // Function returns false on truncated or overlong input
+}
+
+// Function declaration for column chunk encoding into the writer's scratch bytes
+void encode_feature_chunk(const float* chunk_values, int value_count, double quantisation_step, vector<uint8_t>& encoded_bytes) {
+    encoded_bytes.clear();
+    if (quantisation_step > 0.0) {
+        // The system quantises, differences consecutive values and zigzag-varint codes the deltas
+        int64_t previous_level = 0;
+        for (int value_index = 0; value_index < value_count; value_index++) {
+            int64_t quantised_level = llround(chunk_values[value_index] / quantisation_step);
+            int64_t level_delta = quantised_level - previous_level;
+            append_varint(encoded_bytes, (uint64_t(level_delta) << 1) ^ uint64_t(level_delta >> 63));
+            previous_level = quantised_level;
+        }
+    } else {
+        // The system XORs each float's bits with its predecessor; repeated or close values leave small words
+        uint32_t previous_bits = 0;
+        for (int value_index = 0; value_index < value_count; value_index++) {
+            uint32_t value_bits = 0;
+            memcpy(&value_bits, &chunk_values[value_index], sizeof(value_bits));
+            append_varint(encoded_bytes, value_bits ^ previous_bits);
+            previous_bits = value_bits;
+        }
+    }
+}
+
+// Function declaration for column chunk decoding
+bool decode_feature_chunk(const uint8_t* encoded_bytes, const feature_chunk_descriptor& chunk_descriptor,
+                          double quantisation_step, float* decoded_values) {
+    const uint8_t* read_cursor = encoded_bytes;
+    const uint8_t* read_end = encoded_bytes + chunk_descriptor.byte_length;
+    int64_t previous_level = 0;
+    uint32_t previous_bits = 0;
+    for (uint32_t value_index = 0; value_index < chunk_descriptor.value_count; value_index++) {
+        uint64_t encoded_word = 0;
+        if (!read_varint(read_cursor, read_end, encoded_word)) {
+            return false;
+        }
+        if (quantisation_step > 0.0) {
+            previous_level += int64_t(encoded_word >> 1) ^ -int64_t(encoded_word & 1);
+            decoded_values[value_index] = float(previous_level * quantisation_step);
+        } else {
+            previous_bits ^= uint32_t(encoded_word);
+            memcpy(&decoded_values[value_index], &previous_bits, sizeof(previous_bits));
+        }
+    }
+    return read_cursor == read_end;            // Function returns whether the chunk decoded exactly
+}
+
+// Function declaration for feature store creation; the header is written immediately
+bool open_feature_store_writer(feature_store_writer& store_writer, const string& store_path,
+                               const vector<feature_column_schema>& column_schema) {
+    store_writer.store_stream.open(store_path, ios::binary | ios::trunc);
+    store_writer.column_schema = column_schema;
+    store_writer.pending_values.assign(column_schema.size(), vector<float>());
+    store_writer.chunk_index.clear();
+    store_writer.current_track = 0;
+    store_writer.current_frame = 0;
+    uint32_t header_words[3] = {FEATURE_STORE_MAGIC, FEATURE_STORE_VERSION, uint32_t(column_schema.size())};
+    store_writer.store_stream.write(reinterpret_cast<const char*>(header_words), sizeof(header_words));
+    store_writer.write_position = sizeof(header_words);
+    return bool(store_writer.store_stream);    // Function returns whether the header was written
+}
+
+// Function declaration for flushing one column's pending values as an encoded chunk
+void flush_feature_column(feature_store_writer& store_writer, int column_index) {
+    vector<float>& pending_values = store_writer.pending_values[column_index];
+    if (pending_values.empty()) {
+        return;
+    }
+    double quantisation_step = store_writer.column_schema[column_index].quantisation_step;
+    encode_feature_chunk(pending_values.data(), int(pending_values.size()), quantisation_step, store_writer.encode_scratch);
+    feature_chunk_descriptor chunk_descriptor = {uint32_t(column_index), store_writer.current_track,
+                                                 store_writer.current_frame - uint32_t(pending_values.size()), uint32_t(pending_values.size()),
+                                                 store_writer.write_position, store_writer.encode_scratch.size(), 0.0f, 0.0f};
+
+    // Range bounds are taken from the values a reader will decode, so chunk skipping never loses matches
+    vector<float> decoded_values(pending_values.size());
+    decode_feature_chunk(store_writer.encode_scratch.data(), chunk_descriptor, quantisation_step, decoded_values.data());
+    auto value_bounds = minmax_element(decoded_values.begin(), decoded_values.end());
+    chunk_descriptor.minimum_value = *value_bounds.first;
+    chunk_descriptor.maximum_value = *value_bounds.second;
+    store_writer.store_stream.write(reinterpret_cast<const char*>(store_writer.encode_scratch.data()),
+                                    streamsize(store_writer.encode_scratch.size()));
+    store_writer.write_position += store_writer.encode_scratch.size();
+    store_writer.chunk_index.push_back(chunk_descriptor);
+    pending_values.clear();
+}
+
+// Function declaration for starting a new track; pending chunks of the previous track are flushed
+void begin_feature_store_track(feature_store_writer& store_writer, uint32_t track_identifier) {
+    for (int column_index = 0; column_index < int(store_writer.column_schema.size()); column_index++) {
+        flush_feature_column(store_writer, column_index);
+    }
+    store_writer.current_track = track_identifier;
+    store_writer.current_frame = 0;
+}
+
+// Function declaration for appending one frame holding a value for every column
+void append_feature_frame(feature_store_writer& store_writer, const double* frame_values) {
+    store_writer.current_frame++;
+    for (int column_index = 0; column_index < int(store_writer.column_schema.size()); column_index++) {
+        store_writer.pending_values[column_index].push_back(float(frame_values[column_index]));
+        if (int(store_writer.pending_values[column_index].size()) == FEATURE_STORE_CHUNK_VALUES) {
+            flush_feature_column(store_writer, column_index);
+        }
+    }
+}
+
+// Function declaration for finishing a store: remaining chunks, then the schema and footer index, then the trailer
+bool close_feature_store_writer(feature_store_writer& store_writer) {
+    begin_feature_store_track(store_writer, store_writer.current_track);
+    stable_sort(store_writer.chunk_index.begin(), store_writer.chunk_index.end(),
+                [](const feature_chunk_descriptor& left, const feature_chunk_descriptor& right) {
+                    return left.column_index < right.column_index;
+                });
+    uint64_t footer_offset = store_writer.write_position;
+    for (const feature_column_schema& column_definition : store_writer.column_schema) {
+        uint32_t name_length = uint32_t(column_definition.column_name.size());
+        store_writer.store_stream.write(reinterpret_cast<const char*>(&name_length), sizeof(name_length));
+        store_writer.store_stream.write(column_definition.column_name.data(), streamsize(name_length));
+        store_writer.store_stream.write(reinterpret_cast<const char*>(&column_definition.quantisation_step), sizeof(double));
+    }
+    store_writer.store_stream.write(reinterpret_cast<const char*>(store_writer.chunk_index.data()),
+                                    streamsize(store_writer.chunk_index.size() * sizeof(feature_chunk_descriptor)));
+    uint64_t trailer_words[3] = {footer_offset, store_writer.chunk_index.size(), FEATURE_STORE_MAGIC};
+    store_writer.store_stream.write(reinterpret_cast<const char*>(trailer_words), sizeof(trailer_words));
+    store_writer.store_stream.close();
+    return !store_writer.store_stream.fail();  // Function returns whether every write succeeded
+}
+
+// Function declaration for byte access that returns mapped memory directly or fills the stream scratch buffer
+const uint8_t* access_feature_store_bytes(feature_store_reader& store_reader, uint64_t byte_offset, uint64_t byte_length) {
+    if (store_reader.mapped_bytes) {
+        return byte_offset + byte_length <= store_reader.mapped_length ? store_reader.mapped_bytes + byte_offset : nullptr;
+    }
+    store_reader.read_scratch.resize(size_t(byte_length));
+    store_reader.fallback_stream.clear();
+    store_reader.fallback_stream.seekg(streamoff(byte_offset));
+    store_reader.fallback_stream.read(reinterpret_cast<char*>(store_reader.read_scratch.data()), streamsize(byte_length));
+    return store_reader.fallback_stream ? store_reader.read_scratch.data() : nullptr;
+}
+
+// Function declaration for opening a store and loading its schema and footer index
+void open_feature_store(feature_store_reader& store_reader, const string& store_path) {
+    store_reader.mapped_bytes = nullptr;
+    store_reader.mapped_length = 0;
+    store_reader.store_ready = false;
+    store_reader.column_schema.clear();
+    store_reader.chunk_index.clear();
+    error_code size_error;
+    uint64_t file_bytes = filesystem::file_size(store_path, size_error);
+    if (size_error || file_bytes < 12 + 24) {
+        return;
+    }
+#if FEATURE_STORE_USE_MMAP
+    // The system maps the file read-only so a column scan faults in only the pages of the chunks it decodes
+    int file_descriptor = open(store_path.c_str(), O_RDONLY);
+    if (file_descriptor >= 0) {
+        void* mapping = mmap(nullptr, size_t(file_bytes), PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+        close(file_descriptor);
+        if (mapping != MAP_FAILED) {
+            store_reader.mapped_bytes = static_cast<const uint8_t*>(mapping);
+            store_reader.mapped_length = size_t(file_bytes);
+        }
+    }
+#endif
+    if (!store_reader.mapped_bytes) {
+        store_reader.fallback_stream.open(store_path, ios::binary);
+    }
+
+    uint32_t header_words[3] = {0, 0, 0};
+    uint64_t trailer_words[3] = {0, 0, 0};
+    const uint8_t* header_bytes = access_feature_store_bytes(store_reader, 0, sizeof(header_words));
+    if (header_bytes) {
+        memcpy(header_words, header_bytes, sizeof(header_words));
+    }
+    const uint8_t* trailer_bytes = access_feature_store_bytes(store_reader, file_bytes - sizeof(trailer_words), sizeof(trailer_words));
+    if (trailer_bytes) {
+        memcpy(trailer_words, trailer_bytes, sizeof(trailer_words));
+    }
+    if (header_words[0] != FEATURE_STORE_MAGIC || header_words[1] != FEATURE_STORE_VERSION || trailer_words[2] != FEATURE_STORE_MAGIC ||
+        trailer_words[0] >= file_bytes) {
+        return;
+    }
+
+    // The footer holds the schema followed by the chunk descriptors, already ordered by column
+    uint64_t footer_length = file_bytes - sizeof(trailer_words) - trailer_words[0];
+    const uint8_t* footer_bytes = access_feature_store_bytes(store_reader, trailer_words[0], footer_length);
+    if (!footer_bytes) {
+        return;
+    }
+    vector<uint8_t> footer_copy(footer_bytes, footer_bytes + footer_length);
+    size_t footer_position = 0;
+    for (uint32_t column_index = 0; column_index < header_words[2]; column_index++) {
+        uint32_t name_length = 0;
+        if (footer_position + sizeof(name_length) > footer_length) {
+            return;
+        }
+        memcpy(&name_length, footer_copy.data() + footer_position, sizeof(name_length));
+        footer_position += sizeof(name_length);
+        if (footer_position + name_length + sizeof(double) > footer_length) {
+            return;
+        }
+        feature_column_schema column_definition = {string(reinterpret_cast<const char*>(footer_copy.data() + footer_position), name_length), 0.0};
+        memcpy(&column_definition.quantisation_step, footer_copy.data() + footer_position + name_length, sizeof(double));
+        footer_position += name_length + sizeof(double);
+        store_reader.column_schema.push_back(column_definition);
+    }
+    if (footer_length - footer_position != trailer_words[1] * sizeof(feature_chunk_descriptor)) {
+        return;
+    }
+    store_reader.chunk_index.resize(size_t(trailer_words[1]));
+    memcpy(store_reader.chunk_index.data(), footer_copy.data() + footer_position, size_t(footer_length - footer_position));
+    store_reader.store_ready = true;
+}
+
+// Function declaration for releasing a store mapping
+void close_feature_store(feature_store_reader& store_reader) {
+#if FEATURE_STORE_USE_MMAP
+    if (store_reader.mapped_bytes) {
+        munmap(const_cast<uint8_t*>(store_reader.mapped_bytes), store_reader.mapped_length);
+    }
+#endif
+    store_reader.mapped_bytes = nullptr;
+    store_reader.mapped_length = 0;
+    store_reader.fallback_stream.close();
+    store_reader.store_ready = false;
+}
+
+// Function declaration for scanning one column across all tracks; chunks of other columns are never read
+// and chunks whose value range misses [range_minimum, range_maximum] are skipped without decoding
+template <typename chunk_visitor>
+int scan_feature_column(feature_store_reader& store_reader, const string& column_name, chunk_visitor&& visit_chunk,
+                        double range_minimum = -HUGE_VAL, double range_maximum = HUGE_VAL) {
+    int decoded_chunks = 0;
+    auto column_position = find_if(store_reader.column_schema.begin(), store_reader.column_schema.end(),
+                                   [&](const feature_column_schema& column_definition) { return column_definition.column_name == column_name; });
+    if (!store_reader.store_ready || column_position == store_reader.column_schema.end()) {
+        return decoded_chunks;
+    }
+    uint32_t column_index = uint32_t(column_position - store_reader.column_schema.begin());
+    auto first_chunk = lower_bound(store_reader.chunk_index.begin(), store_reader.chunk_index.end(), column_index,
+                                   [](const feature_chunk_descriptor& chunk_descriptor, uint32_t searched_column) {
+                                       return chunk_descriptor.column_index < searched_column;
+                                   });
+    for (auto chunk_position = first_chunk; chunk_position != store_reader.chunk_index.end() &&
+                                            chunk_position->column_index == column_index; ++chunk_position) {
+        if (chunk_position->maximum_value < range_minimum || chunk_position->minimum_value > range_maximum) {
+            continue;
+        }
+        const uint8_t* encoded_bytes = access_feature_store_bytes(store_reader, chunk_position->byte_offset, chunk_position->byte_length);
+        store_reader.decode_scratch.resize(chunk_position->value_count);
+        if (!encoded_bytes ||
+            !decode_feature_chunk(encoded_bytes, *chunk_position, column_position->quantisation_step, store_reader.decode_scratch.data())) {
+            continue;
+        }
+        visit_chunk(*chunk_position, store_reader.decode_scratch.data());
+        decoded_chunks++;
+    }
+    return decoded_chunks;                     // Function returns the number of chunks decoded and visited
+}
+
+// Chroma feature layout for structural analysis
+const int CHROMA_BIN_COUNT = 12;              // Pitch classes per chroma vector
+const double CHROMA_COMPRESSION_GAIN = 10.0;  // Log compression gain applied to peak-relative class energy
+const int CHROMA_FRAME_LENGTH = 8 * AUDIO_BUFFER_SIZE; // Frame long enough to separate semitones near 100 Hz
+
+// Structure definition for streaming chroma extraction with frame aggregation into feature rows
+struct chroma_extractor_state {
+    int frame_length;                         // STFT frame length
+    int hop_length;                           // Frames between analysis frames
+    int aggregation_frames;                   // STFT frames averaged into one feature row
+    const fft_transform_plan* transform_plan; // Shared plan for the frame length
+    const double* frame_window;               // Shared square-root Hann window, squared per sample
+    mono_hop_history hop_history;             // Sliding frame of mono downmix
+    vector<double> transform_real;            // Transform scratch, real parts
+    vector<double> transform_imag;            // Transform scratch, imaginary parts
+    vector<double> first_power_spectrum;      // Unmixed power of the first frame of a pair
+    vector<double> second_power_spectrum;     // Unmixed power of the second frame of a pair
+    bool frame_pending;                       // Whether a windowed frame waits in the real part for its partner
+    int lowest_peak_bin;                      // First bin searched for spectral peaks (80 Hz)
+    int highest_peak_bin;                     // Last bin searched for spectral peaks (5 kHz)
+    double chroma_accumulator[CHROMA_BIN_COUNT]; // Pitch class energy of the row being aggregated
+    int aggregated_count;                     // STFT frames in the current row
+    vector<float> chroma_rows;                // Completed unit-length rows, CHROMA_BIN_COUNT values each
+};
+
+// Structure definition for configuration of self-similarity segmentation
+struct structural_segmentation_configuration {
+    int kernel_half_width;                    // Checkerboard kernel half width in feature rows
+    int tile_size;                            // Rows per cache-blocked similarity tile edge
+    int worker_count;                         // Threads computing similarity tiles
+    double peak_threshold;                    // Novelty margin above the local mean required for a boundary
+    double minimum_segment_seconds;           // Minimum spacing between boundaries
+    double label_similarity;                  // Mean-chroma cosine above which segments share a label
+};
+
+// Structure definition for the banded self-similarity matrix; row i holds lags 0..band_width
+struct self_similarity_band {
+    int row_count;                            // Feature rows in the track
+    int band_width;                           // Largest stored lag
+    vector<float> similarity_values;          // Row-major (row_count x (band_width + 1)) cosine similarities
+};
+
+// Structure definition for one labelled structural segment
+struct structural_segment {
+    double start_seconds;                     // Segment start
+    double end_seconds;                       // Segment end
+    char section_label;                       // Letter shared by segments with matching harmony
+};
+
+// Structure definition for segmentation results
+struct structural_segmentation_report {
+    vector<structural_segment> segments;      // Segments in time order
+    vector<double> novelty_curve;             // Normalised novelty per feature row
+    size_t band_bytes;                        // Memory held by the banded similarity matrix
+};
+
+// Function declaration for chroma extractor initialization
+chroma_extractor_state initialize_chroma_extractor(int aggregation_frames) {
+    chroma_extractor_state extractor_state = {}; // Local state structure instance with zeroed accumulators
+    extractor_state.frame_length = CHROMA_FRAME_LENGTH;
+    extractor_state.hop_length = CHROMA_FRAME_LENGTH / 2;
+    extractor_state.aggregation_frames = max(1, aggregation_frames);
+    extractor_state.transform_plan = &acquire_fft_plan(CHROMA_FRAME_LENGTH);
+    extractor_state.frame_window = acquire_sqrt_hann_window(CHROMA_FRAME_LENGTH);
+    extractor_state.hop_history = initialize_mono_hop_history(CHROMA_FRAME_LENGTH, extractor_state.hop_length);
+    extractor_state.transform_real.assign(CHROMA_FRAME_LENGTH, 0.0);
+    extractor_state.transform_imag.assign(CHROMA_FRAME_LENGTH, 0.0);
+    extractor_state.first_power_spectrum.assign(CHROMA_FRAME_LENGTH / 2 + 1, 0.0);
+    extractor_state.second_power_spectrum.assign(CHROMA_FRAME_LENGTH / 2 + 1, 0.0);
+    extractor_state.lowest_peak_bin = max(2, int(80.0 * CHROMA_FRAME_LENGTH / SAMPLE_RATE));
+    extractor_state.highest_peak_bin = min(CHROMA_FRAME_LENGTH / 2 - 1, int(5000.0 * CHROMA_FRAME_LENGTH / SAMPLE_RATE));
+    return extractor_state;                    // Function returns prepared extractor
+}
+
+// Function declaration for chroma accumulation from one frame's power spectrum
+void accumulate_chroma_spectrum(chroma_extractor_state& extractor_state, const double* power_spectrum) {
+    // Only spectral peaks contribute, at parabolically interpolated frequencies, because at low pitches the
+    // Hann main lobe spans several semitones and whole-bin mapping would smear energy across classes
+    for (int bin_index = extractor_state.lowest_peak_bin; bin_index <= extractor_state.highest_peak_bin; bin_index++) {
+        double peak_power = power_spectrum[bin_index];
+        if (peak_power <= power_spectrum[bin_index - 1] || peak_power < power_spectrum[bin_index + 1] || peak_power < 1e-12) {
+            continue;
+        }
+        double lower_level = log(power_spectrum[bin_index - 1] + 1e-30);
+        double centre_level = log(peak_power);
+        double upper_level = log(power_spectrum[bin_index + 1] + 1e-30);
+        double curvature = lower_level - 2.0 * centre_level + upper_level;
+        double bin_offset = curvature < 0.0 ? 0.5 * (lower_level - upper_level) / curvature : 0.0;
+        double peak_frequency = (bin_index + bin_offset) * SAMPLE_RATE / extractor_state.frame_length;
+        int semitone_offset = int(lround(12.0 * log2(peak_frequency / 440.0)));
+        extractor_state.chroma_accumulator[((semitone_offset % CHROMA_BIN_COUNT) + CHROMA_BIN_COUNT) % CHROMA_BIN_COUNT] += peak_power;
+    }
+
+    // Completed rows are scaled to their strongest class, log compressed and set to unit length so that
+    // leakage stays well below sounding pitch classes and row dot products are cosine similarities
+    if (++extractor_state.aggregated_count == extractor_state.aggregation_frames) {
+        double compressed_values[CHROMA_BIN_COUNT];
+        double strongest_class = *max_element(extractor_state.chroma_accumulator, extractor_state.chroma_accumulator + CHROMA_BIN_COUNT);
+        double relative_scale = strongest_class > 1e-20 ? 1.0 / strongest_class : 0.0;
+        double squared_length = 0.0;
+        for (int class_index = 0; class_index < CHROMA_BIN_COUNT; class_index++) {
+            compressed_values[class_index] = log1p(CHROMA_COMPRESSION_GAIN * relative_scale * extractor_state.chroma_accumulator[class_index]);
+            squared_length += compressed_values[class_index] * compressed_values[class_index];
+            extractor_state.chroma_accumulator[class_index] = 0.0;
+        }
+        double length_scale = squared_length > 1e-12 ? 1.0 / sqrt(squared_length) : 0.0;
+        for (int class_index = 0; class_index < CHROMA_BIN_COUNT; class_index++) {
+            extractor_state.chroma_rows.push_back(float(compressed_values[class_index] * length_scale));
+        }
+        extractor_state.aggregated_count = 0;
+    }
+}
+
+// Function declaration for one completed STFT frame; frames are transformed in pairs through one complex FFT
+void accumulate_chroma_frame(chroma_extractor_state& extractor_state, const double* frame_samples, bool flush_unpaired) {
+    double* transform_real = extractor_state.transform_real.data();
+    double* transform_imag = extractor_state.transform_imag.data();
+    int frame_length = extractor_state.frame_length;
+    if (!flush_unpaired) {
+        // The first frame of a pair fills the real part and the second the imaginary part
+        double* packed_part = extractor_state.frame_pending ? transform_imag : transform_real;
+        for (int sample_index = 0; sample_index < frame_length; sample_index++) {
+            double window_value = extractor_state.frame_window[sample_index];
+            packed_part[sample_index] = frame_samples[sample_index] * window_value * window_value;
+        }
+        extractor_state.frame_pending = !extractor_state.frame_pending;
+        if (extractor_state.frame_pending) {
+            return;
+        }
+    } else if (extractor_state.frame_pending) {
+        fill(transform_imag, transform_imag + frame_length, 0.0);
+        extractor_state.frame_pending = false;
+    } else {
+        return;
+    }
+    execute_fft(*extractor_state.transform_plan, transform_real, transform_imag, false);
+
+    // The system unmixes both real spectra from mirror bins: X = (Z[k] + conj Z[N-k]) / 2, Y = (Z[k] - conj Z[N-k]) / 2i
+    double* first_power = extractor_state.first_power_spectrum.data();
+    double* second_power = extractor_state.second_power_spectrum.data();
+    for (int bin_index = extractor_state.lowest_peak_bin - 1; bin_index <= extractor_state.highest_peak_bin + 1; bin_index++) {
+        int mirror_index = frame_length - bin_index;
+        double sum_real = transform_real[bin_index] + transform_real[mirror_index];
+        double difference_imag = transform_imag[bin_index] - transform_imag[mirror_index];
+        double sum_imag = transform_imag[bin_index] + transform_imag[mirror_index];
+        double difference_real = transform_real[bin_index] - transform_real[mirror_index];
+        first_power[bin_index] = 0.25 * (sum_real * sum_real + difference_imag * difference_imag);
+        second_power[bin_index] = 0.25 * (sum_imag * sum_imag + difference_real * difference_real);
+    }
+    accumulate_chroma_spectrum(extractor_state, first_power);
+    if (!flush_unpaired) {
+        accumulate_chroma_spectrum(extractor_state, second_power);
+    }
+}
+
+// Function declaration for streaming chroma extraction from the mono downmix of a block
+void feed_chroma_extractor(chroma_extractor_state& extractor_state, const audio_processing_buffer& source_buffer) {
+    // The system accumulates each completed frame as soon as its hop arrives
+    stream_mono_hops(extractor_state.hop_history, source_buffer, [&](const double* frame_samples) {
+        accumulate_chroma_frame(extractor_state, frame_samples, false);
+    });
+}
+
+// Function declaration for end-of-stream chroma flush of a frame still waiting for its FFT partner
+void finalize_chroma_extractor(chroma_extractor_state& extractor_state) {
+    accumulate_chroma_frame(extractor_state, nullptr, true);
+}
+
+// Function declaration for banded self-similarity in cache-blocked tiles spread across worker threads
+self_similarity_band compute_self_similarity_band(const vector<float>& feature_rows, int feature_dimension, int band_width,
+                                                  int tile_size, int worker_count) {
+    self_similarity_band similarity_band;      // Local band structure instance
+    similarity_band.row_count = int(feature_rows.size()) / feature_dimension;
+    similarity_band.band_width = band_width;
+    similarity_band.similarity_values.assign(size_t(similarity_band.row_count) * (band_width + 1), 0.0f);
+    int row_count = similarity_band.row_count;
+    tile_size = max(1, tile_size);
+    int block_count = (row_count + tile_size - 1) / tile_size;
+
+    // Each worker owns every worker_count-th row block, so tiles write disjoint band rows without locking;
+    // within a tile the column block's feature rows stay cache resident while the row block sweeps them
+    auto compute_row_blocks = [&](int worker_index) {
+        for (int row_block = worker_index; row_block < block_count; row_block += worker_count) {
+            int row_begin = row_block * tile_size;
+            int row_end = min(row_count, row_begin + tile_size);
+            int last_column_block = min(block_count - 1, (row_end - 1 + band_width) / tile_size);
+            for (int column_block = row_block; column_block <= last_column_block; column_block++) {
+                int column_begin = column_block * tile_size;
+                int column_end = min(row_count, column_begin + tile_size);
+                for (int row_index = row_begin; row_index < row_end; row_index++) {
+                    const float* row_features = feature_rows.data() + size_t(row_index) * feature_dimension;
+                    float* band_row = similarity_band.similarity_values.data() + size_t(row_index) * (band_width + 1);
+                    int first_column = max(column_begin, row_index);
+                    int last_column = min(column_end, row_index + band_width + 1);
+                    for (int column_index = first_column; column_index < last_column; column_index++) {
+                        const float* column_features = feature_rows.data() + size_t(column_index) * feature_dimension;
+                        float dot_product = 0.0f;
+                        for (int dimension_index = 0; dimension_index < feature_dimension; dimension_index++) {
+                            dot_product += row_features[dimension_index] * column_features[dimension_index];
+                        }
+                        band_row[column_index - row_index] = dot_product;
+                    }
+                }
+            }
+        }
+    };
+    worker_count = max(1, min(worker_count, block_count));
+    vector<thread> tile_workers;
+    for (int worker_index = 1; worker_index < worker_count; worker_index++) {
+        tile_workers.emplace_back(compute_row_blocks, worker_index);
+    }
+    compute_row_blocks(0);
+    for (thread& tile_worker : tile_workers) {
+        tile_worker.join();
+    }
+    return similarity_band;                    // Function returns the populated band
+}
+
+// Function declaration for checkerboard-kernel novelty read entirely from the band (needs band_width >= 2 * half width)
+vector<double> compute_checkerboard_novelty(const self_similarity_band& similarity_band, int kernel_half_width) {
+    int row_count = similarity_band.row_count;
+    int band_stride = similarity_band.band_width + 1;
+    vector<double> novelty_curve(row_count, 0.0);
+
+    // The system tapers the kernel with a Gaussian; same-side quadrants count positively, cross quadrants negatively
+    vector<double> kernel_taper(2 * kernel_half_width);
+    for (int offset_index = 0; offset_index < 2 * kernel_half_width; offset_index++) {
+        double centred_offset = (offset_index - kernel_half_width + 0.5) / (0.5 * kernel_half_width);
+        kernel_taper[offset_index] = exp(-0.5 * centred_offset * centred_offset);
+    }
+    double kernel_norm = 0.0;
+    for (double row_taper : kernel_taper) {
+        for (double column_taper : kernel_taper) {
+            kernel_norm += row_taper * column_taper;
+        }
+    }
+    for (int centre_row = 0; centre_row < row_count; centre_row++) {
+        double novelty_sum = 0.0;
+        for (int row_offset = 0; row_offset < 2 * kernel_half_width; row_offset++) {
+            int row_index = centre_row - kernel_half_width + row_offset;
+            if (row_index < 0 || row_index >= row_count) {
+                continue;
+            }
+            // Symmetry lets the system visit only column offsets at or after the row offset, doubling the rest
+            for (int column_offset = row_offset; column_offset < 2 * kernel_half_width; column_offset++) {
+                int column_index = centre_row - kernel_half_width + column_offset;
+                if (column_index >= row_count) {
+                    break;
+                }
+                double kernel_sign = (row_offset < kernel_half_width) == (column_offset < kernel_half_width) ? 1.0 : -1.0;
+                double kernel_weight = kernel_sign * kernel_taper[row_offset] * kernel_taper[column_offset] * (column_offset == row_offset ? 1.0 : 2.0);
+                novelty_sum += kernel_weight * similarity_band.similarity_values[size_t(row_index) * band_stride + (column_index - row_index)];
+            }
+        }
+        novelty_curve[centre_row] = max(0.0, novelty_sum / kernel_norm);
+    }
+
+    // Rows within half a kernel of either end see a one-sided kernel, so the system leaves their novelty at zero
+    for (int edge_row = 0; edge_row < min(kernel_half_width, row_count); edge_row++) {
+        novelty_curve[edge_row] = 0.0;
+        novelty_curve[row_count - 1 - edge_row] = 0.0;
+    }
+    return novelty_curve;                      // Function returns the unnormalised novelty per row
+}
+
+// Function declaration for structural segmentation of chroma rows with novelty boundaries and harmonic labels
+structural_segmentation_report segment_track_structure(const vector<float>& chroma_rows, double row_seconds,
+                                                       const structural_segmentation_configuration& configuration) {
+    structural_segmentation_report segmentation_report; // Local report structure instance
+    int kernel_half_width = configuration.kernel_half_width;
+    self_similarity_band similarity_band = compute_self_similarity_band(chroma_rows, CHROMA_BIN_COUNT, 2 * kernel_half_width,
+                                                                       configuration.tile_size, configuration.worker_count);
+    segmentation_report.band_bytes = similarity_band.similarity_values.size() * sizeof(float);
+    segmentation_report.novelty_curve = compute_checkerboard_novelty(similarity_band, kernel_half_width);
+    vector<double>& novelty_curve = segmentation_report.novelty_curve;
+    int row_count = similarity_band.row_count;
+    if (row_count == 0) {
+        return segmentation_report;            // Function returns an empty report when there are no feature rows
+    }
+    double novelty_peak = *max_element(novelty_curve.begin(), novelty_curve.end());
+    for (double& novelty_value : novelty_curve) {
+        novelty_value /= max(novelty_peak, 1e-12);
+    }
+
+    // Boundaries are local maxima over the minimum segment span that clear the local mean by the threshold
+    int suppression_rows = max(1, int(configuration.minimum_segment_seconds / row_seconds));
+    vector<double> novelty_prefix(row_count + 1, 0.0);
+    for (int row_index = 0; row_index < row_count; row_index++) {
+        novelty_prefix[row_index + 1] = novelty_prefix[row_index] + novelty_curve[row_index];
+    }
+    vector<int> boundary_rows = {0};
+    for (int row_index = 1; row_index < row_count; row_index++) {
+        int window_begin = max(0, row_index - suppression_rows);
+        int window_end = min(row_count, row_index + suppression_rows + 1);
+        double local_mean = (novelty_prefix[window_end] - novelty_prefix[window_begin]) / (window_end - window_begin);
+        bool local_maximum = *max_element(novelty_curve.begin() + window_begin, novelty_curve.begin() + window_end) == novelty_curve[row_index];
+        if (local_maximum && novelty_curve[row_index] > local_mean + configuration.peak_threshold &&
+            row_index - boundary_rows.back() >= suppression_rows) {
+            boundary_rows.push_back(row_index);
+        }
+    }
+    boundary_rows.push_back(row_count);
+
+    // The system labels segments by the cosine similarity of their mean chroma to earlier label prototypes
+    vector<vector<double>> label_prototypes;
+    for (size_t segment_index = 0; segment_index + 1 < boundary_rows.size(); segment_index++) {
+        vector<double> mean_chroma(CHROMA_BIN_COUNT, 0.0);
+        for (int row_index = boundary_rows[segment_index]; row_index < boundary_rows[segment_index + 1]; row_index++) {
+            for (int class_index = 0; class_index < CHROMA_BIN_COUNT; class_index++) {
+                mean_chroma[class_index] += chroma_rows[size_t(row_index) * CHROMA_BIN_COUNT + class_index];
+            }
+        }
+        double mean_length = sqrt(inner_product(mean_chroma.begin(), mean_chroma.end(), mean_chroma.begin(), 0.0)) + 1e-12;
+        for (double& class_value : mean_chroma) {
+            class_value /= mean_length;
+        }
+        int matched_label = -1;
+        double best_similarity = configuration.label_similarity;
+        for (size_t label_index = 0; label_index < label_prototypes.size(); label_index++) {
+            double prototype_similarity = inner_product(mean_chroma.begin(), mean_chroma.end(), label_prototypes[label_index].begin(), 0.0);
+            if (prototype_similarity >= best_similarity) {
+                best_similarity = prototype_similarity;
+                matched_label = int(label_index);
+            }
+        }
+        if (matched_label < 0 && label_prototypes.size() < 26) {
+            label_prototypes.push_back(mean_chroma);
+            matched_label = int(label_prototypes.size()) - 1;
+        }
+        segmentation_report.segments.push_back({boundary_rows[segment_index] * row_seconds, boundary_rows[segment_index + 1] * row_seconds,
+                                                char('A' + max(0, matched_label))});
+    }
+    return segmentation_report;                // Function returns labelled segments and the novelty curve
+}
+
+// Primary program execution function with comprehensive media processing simulation
+int main() {
+    // The system displays professional application header and identification
+    cout << "Professional Media Player Processing System v1.0\n";
+    cout << "Advanced Codec Processing and Audio Analysis Framework\n";
+    cout << string(60, '=') << "\n";
+    
+    // The system initializes media resource with professional specifications
+    media_file_metadata primary_media_resource = initialize_media_resource(
+        "professional_audio_sample.mp3",      // Resource identifier specification
+        "MP3",                                 // Format type designation
+        180.0,                                 // Duration specification in seconds
+        320                                    // Bit rate specification in kbps
+    );
+    
+    // The system displays media resource configuration information
+    cout << "\nMEDIA RESOURCE CONFIGURATION:\n";
+    cout << string(40, '-') << "\n";
+    cout << "Resource Identifier: " << primary_media_resource.file_identifier << "\n";
+    cout << "Format Specification: " << primary_media_resource.format_specification << "\n";
+    cout << "Duration Parameters: " << fixed << setprecision(1) 
+         << primary_media_resource.duration_seconds << " seconds\n";
+    cout << "Bit Rate Configuration: " << primary_media_resource.bit_rate_kbps << " kbps\n";
+    cout << "Codec Compatibility: " << (primary_media_resource.codec_support_status ? "SUPPORTED" : "UNSUPPORTED") << "\n";
+    
+    // The system initializes audio processing buffer for analysis operations
+    audio_processing_buffer primary_audio_buffer = process_audio_buffer(AUDIO_BUFFER_SIZE);
+    
+    // The system displays audio buffer configuration parameters
+    cout << "\nAUDIO BUFFER CONFIGURATION:\n";
+    cout << string(40, '-') << "\n";
+    cout << "Buffer Capacity: " << AUDIO_BUFFER_SIZE << " samples\n";
+    cout << "Sampling Frequency: " << SAMPLE_RATE << " Hz\n";
+    cout << "Processing Framework: Real-time audio analysis\n";
+    
+    // The system initializes performance tracking data structures
+    vector<double> processing_time_measurements;   // Container for timing data collection
+    vector<double> efficiency_measurements;        // Container for efficiency metric storage
+    
+    // The system reserves memory capacity for performance data collection
+    processing_time_measurements.reserve(TOTAL_SIMULATION_CYCLES);
+    efficiency_measurements.reserve(TOTAL_SIMULATION_CYCLES);
+    
+    // The system initiates media processing simulation cycle execution
+    cout << "\nINITIATING MEDIA PROCESSING SIMULATION:\n";
+    cout << string(40, '-');
+    
+    // Primary processing loop executes specified number of simulation cycles
+    for (int cycle_iteration = 1; cycle_iteration <= TOTAL_SIMULATION_CYCLES; cycle_iteration++) {
+        // The system executes codec processing simulation with performance measurement
+        double cycle_processing_time = simulate_codec_processing(primary_media_resource, cycle_iteration);
+        
+        // The system calculates processing efficiency based on cycle performance
+        double cycle_efficiency = (1000.0 / cycle_processing_time) * 
+                                 (primary_media_resource.bit_rate_kbps / 320.0);
+        
+        // The system stores performance measurements for statistical analysis
+        processing_time_measurements.push_back(cycle_processing_time);
+        efficiency_measurements.push_back(cycle_efficiency);
+        
+        // The system displays real-time progress visualization
+        display_progress_visualization(cycle_iteration, TOTAL_SIMULATION_CYCLES, 
+                                     cycle_processing_time, cycle_efficiency);
+    }
+    
+    // The system generates comprehensive performance analysis report
+    generate_performance_analytics(processing_time_measurements, efficiency_measurements, 
+                                 primary_audio_buffer);
+    
+    // The system configures the in-place processing chain with a gentle RMS compressor
+    audio_processing_chain primary_processing_chain;
+    primary_processing_chain.dc_blocking_stage_enabled = true;
+    primary_processing_chain.dc_blocking_state = initialize_dc_blocking_filter(1, false);
+    primary_processing_chain.equalizer_stage_enabled = true;
+    primary_processing_chain.equalizer_state = initialize_parametric_equalizer(
+        {{BIQUAD_LOW_SHELF, 120.0, 0.707, 1.5}, {BIQUAD_PEAKING, 3000.0, 1.0, 2.0}, {BIQUAD_HIGH_SHELF, 10000.0, 0.707, -1.5}}, 1);
+    primary_processing_chain.convolution_stage_enabled = false;
+    primary_processing_chain.dynamics_stage_enabled = true;
+    primary_processing_chain.dynamics_configuration = {DYNAMICS_COMPRESSOR, DETECTION_RMS,
+                                                       -12.0, 3.0, 5.0, 80.0, 60.0, 3.0};
+    primary_processing_chain.dynamics_state = initialize_dynamics_processor(
+        primary_processing_chain.dynamics_configuration);
+    
+    // The system streams a tone stepping between quiet and loud half-second passages through the chain
+    const int chain_segment_frames = int(SAMPLE_RATE) / 2;
+    const int chain_segment_count = 8;
+    const int chain_blocks = chain_segment_count * chain_segment_frames / AUDIO_BUFFER_SIZE;
+    audio_processing_buffer chain_audio_buffer;
+    chain_audio_buffer.channel_count = 1;
+    chain_audio_buffer.sample_data_array.resize(AUDIO_BUFFER_SIZE);
+    vector<double> chain_input(size_t(chain_blocks) * AUDIO_BUFFER_SIZE);
+    vector<double> chain_output(chain_input.size());
+    for (size_t frame_index = 0; frame_index < chain_input.size(); frame_index++) {
+        double passage_amplitude = (frame_index / chain_segment_frames) % 2 == 0 ? 0.1 : 0.7;
+        chain_input[frame_index] = passage_amplitude * sin(2.0 * M_PI * 440.0 * frame_index / SAMPLE_RATE);
+    }
+    for (int block_index = 0; block_index < chain_blocks; block_index++) {
+        copy(chain_input.begin() + size_t(block_index) * AUDIO_BUFFER_SIZE,
+             chain_input.begin() + size_t(block_index + 1) * AUDIO_BUFFER_SIZE,
+             chain_audio_buffer.sample_data_array.begin());
+        run_audio_processing_chain(chain_audio_buffer, primary_processing_chain);
+        copy(chain_audio_buffer.sample_data_array.begin(), chain_audio_buffer.sample_data_array.end(),
+             chain_output.begin() + size_t(block_index) * AUDIO_BUFFER_SIZE);
+    }
+    
+    // The system compares settled quiet and loud passage levels before and after the chain
+    double quiet_square_sum[2] = {0.0, 0.0};
+    double loud_square_sum[2] = {0.0, 0.0};
+    long long settled_frame_count[2] = {0, 0};
+    for (size_t frame_index = 0; frame_index < chain_input.size(); frame_index++) {
+        if (frame_index % chain_segment_frames < size_t(chain_segment_frames) / 2) {
+            continue;                          // The system skips attack and release transients
+        }
+        bool loud_passage = (frame_index / chain_segment_frames) % 2 == 1;
+        double* passage_square_sum = loud_passage ? loud_square_sum : quiet_square_sum;
+        passage_square_sum[0] += chain_input[frame_index] * chain_input[frame_index];
+        passage_square_sum[1] += chain_output[frame_index] * chain_output[frame_index];
+        settled_frame_count[loud_passage ? 1 : 0]++;
+    }
+    
+    cout << "\nIN-PLACE PROCESSING CHAIN:\n";
+    cout << string(50, '-') << "\n";
+    cout << "DC Estimation Stage: Pre-Chain Input Offset " << setprecision(6)
+         << estimated_dc_offset(primary_processing_chain.dc_blocking_state) << " (estimation only)"
+         << " | Post-Chain Output Offset: " << accumulate(chain_output.begin(), chain_output.end(), 0.0) / chain_output.size()
+         << "\n";
+    cout << "Equalizer Stage: " << primary_processing_chain.equalizer_state.section_count
+         << " cascaded biquad sections";
+    if (primary_processing_chain.equalizer_state.dropped_band_count > 0) {
+        cout << " | Bands Dropped Beyond Capacity: " << primary_processing_chain.equalizer_state.dropped_band_count;
+    }
+    cout << "\n";
+    cout << "Dynamics Stage: Compressor " << setprecision(1)
+         << primary_processing_chain.dynamics_configuration.ratio << ":1 above "
+         << primary_processing_chain.dynamics_configuration.threshold_db << " dBFS"
+         << " | Makeup Gain: " << primary_processing_chain.dynamics_configuration.makeup_gain_db << " dB"
+         << " | Maximum Gain Reduction: " << setprecision(2)
+         << primary_processing_chain.dynamics_state.maximum_gain_reduction_db << " dB\n";
+    const char* chain_stage_labels[2] = {"Chain Input ", "Chain Output"};
+    for (int stage_index = 0; stage_index < 2; stage_index++) {
+        double quiet_rms = sqrt(quiet_square_sum[stage_index] / settled_frame_count[0]);
+        double loud_rms = sqrt(loud_square_sum[stage_index] / settled_frame_count[1]);
+        cout << chain_stage_labels[stage_index] << " | Quiet Passage RMS: " << setprecision(4) << quiet_rms
+             << " | Loud Passage RMS: " << loud_rms << " | Loud/Quiet Spread: " << setprecision(1)
+             << 20.0 * log10(loud_rms / quiet_rms) << " dB\n";
+    }
+    
+    // The system prepares a deliberately overdriven buffer to exercise the clipping analyzer
+    audio_processing_buffer overdriven_audio_buffer;
+    overdriven_audio_buffer.channel_count = 1;
+    for (int sample_index = 0; sample_index < AUDIO_BUFFER_SIZE; sample_index++) {
+        double sample_amplitude = 1.2 * sin(2.0 * M_PI * 4.0 * sample_index / AUDIO_BUFFER_SIZE);
+        overdriven_audio_buffer.sample_data_array.push_back(max(-1.0, min(1.0, sample_amplitude)));
+    }
+    measure_audio_buffer_levels(overdriven_audio_buffer);
+    
+    // The system detects and reconstructs clipped regions using autoregressive interpolation
+    clipping_detector_configuration clipping_configuration = {0.999, 3, DECLIP_AUTOREGRESSIVE, 16, 96};
+    clipping_analysis_report primary_clipping_report = detect_clipping_events(primary_audio_buffer,
+                                                                              clipping_configuration);
+    clipping_analysis_report overdriven_clipping_report = detect_clipping_events(overdriven_audio_buffer,
+                                                                                 clipping_configuration);
+    reconstruct_clipped_regions(overdriven_audio_buffer, overdriven_clipping_report, clipping_configuration);
+    measure_audio_buffer_levels(overdriven_audio_buffer);
+    
+    cout << "\nCLIPPING DETECTION AND RECONSTRUCTION:\n";
+    cout << string(50, '-') << "\n";
+    display_clipping_analysis("Primary Buffer", primary_clipping_report);
+    display_clipping_analysis("Overdriven Test Buffer", overdriven_clipping_report);
+    cout << "Reconstructed Peak Amplitude: " << setprecision(4)
+         << overdriven_audio_buffer.peak_amplitude_level << "\n";
+    
+    // The system writes a stereo recording with leading, internal and trailing dead air
+    string silence_test_path = analysis_storage_path("artlest_silence_test.f32");
+    {
+        ofstream pcm_output(silence_test_path, ios::binary);
+        const double segment_seconds[5] = {0.5, 1.0, 0.3, 1.0, 0.7};
+        for (int segment_index = 0; segment_index < 5; segment_index++) {
+            int segment_frames = int(segment_seconds[segment_index] * SAMPLE_RATE);
+            for (int frame_index = 0; frame_index < segment_frames; frame_index++) {
+                float tone_sample = (segment_index % 2 == 1) ?
+                    float(0.4 * sin(2.0 * M_PI * 440.0 * frame_index / SAMPLE_RATE)) : 0.0f;
+                float stereo_frame[2] = {tone_sample, 0.5f * tone_sample};
+                pcm_output.write(reinterpret_cast<const char*>(stereo_frame), sizeof(stereo_frame));
+            }
+        }
+    }
+    
+    // The system streams the recording through the silence detector
+    silence_detector_configuration silence_configuration = {-60.0, 200.0};
+    silence_analysis_report silence_report = scan_pcm_file_for_silence(silence_test_path, 2,
+                                                                       silence_configuration);
+    filesystem::remove(silence_test_path);
+    
+    cout << "\nSILENCE DETECTION AND TRIMMING:\n";
+    cout << string(50, '-') << "\n";
+    display_silence_analysis(silence_report);
+    
+    // The system analyses a widened stereo block sequence in one fused pass per block
+    stereo_image_accumulator stereo_image = initialize_stereo_image_accumulator();
+    audio_processing_buffer stereo_audio_buffer;
+    stereo_audio_buffer.channel_count = 2;
+    stereo_audio_buffer.sample_data_array.resize(2 * AUDIO_BUFFER_SIZE);
+    double minimum_block_correlation = 1.0;
+    for (int block_index = 0; block_index < 8; block_index++) {
+        double* left_plane = access_channel_plane(stereo_audio_buffer, 0);
+        double* right_plane = access_channel_plane(stereo_audio_buffer, 1);
+        for (int frame_index = 0; frame_index < AUDIO_BUFFER_SIZE; frame_index++) {
+            double stream_time = (block_index * AUDIO_BUFFER_SIZE + frame_index) / SAMPLE_RATE;
+            left_plane[frame_index] = 0.5 * sin(2.0 * M_PI * 220.0 * stream_time);
+            right_plane[frame_index] = 0.4 * sin(2.0 * M_PI * 220.0 * stream_time + 0.6);
+        }
+        stereo_block_metrics block_metrics = analyze_stereo_block(stereo_image, stereo_audio_buffer);
+        minimum_block_correlation = min(minimum_block_correlation, block_metrics.phase_correlation);
+    }
+    
+    cout << "\nSTEREO IMAGE AND MONO COMPATIBILITY:\n";
+    cout << string(50, '-') << "\n";
+    display_stereo_image_analysis(stereo_image);
+    cout << "Minimum Block Correlation: " << setprecision(4) << minimum_block_correlation << "\n";
+    
+    // The system streams a biased stereo recording through the DC-blocking stage block by block
+    dc_blocking_filter_state dc_removal_state = initialize_dc_blocking_filter(2);
+    audio_processing_buffer biased_audio_buffer;
+    biased_audio_buffer.channel_count = 2;
+    biased_audio_buffer.sample_data_array.resize(2 * AUDIO_BUFFER_SIZE);
+    double residual_sample_sum = 0.0;
+    const int dc_test_blocks = int(SAMPLE_RATE) / AUDIO_BUFFER_SIZE;
+    for (int block_index = 0; block_index < dc_test_blocks; block_index++) {
+        for (int channel_index = 0; channel_index < 2; channel_index++) {
+            double* channel_plane = access_channel_plane(biased_audio_buffer, channel_index);
+            for (int frame_index = 0; frame_index < AUDIO_BUFFER_SIZE; frame_index++) {
+                double stream_time = (block_index * AUDIO_BUFFER_SIZE + frame_index) / SAMPLE_RATE;
+                channel_plane[frame_index] = 0.3 * sin(2.0 * M_PI * 330.0 * stream_time) +
+                                             (channel_index == 0 ? 0.08 : -0.04);
+            }
+        }
+        apply_dc_blocking_filter(biased_audio_buffer, dc_removal_state);
+        measure_audio_buffer_levels(biased_audio_buffer);
+        residual_sample_sum += biased_audio_buffer.dc_offset_level * biased_audio_buffer.sample_data_array.size();
+    }
+    double residual_dc_offset = residual_sample_sum / (double(dc_test_blocks) * biased_audio_buffer.sample_data_array.size());
+    
+    cout << "\nDC OFFSET ESTIMATION AND REMOVAL:\n";
+    cout << string(50, '-') << "\n";
+    cout << "Estimated Input DC Offset: " << setprecision(6) << estimated_dc_offset(dc_removal_state)
+         << " (left " << dc_removal_state.channel_sample_sum[0] / dc_removal_state.estimated_frame_count
+         << ", right " << dc_removal_state.channel_sample_sum[1] / dc_removal_state.estimated_frame_count << ")\n";
+    cout << "Residual DC Offset After Blocking (whole run): " << residual_dc_offset << "\n";
+    
+    // The system builds a half-second decaying noise impulse response for the convolution engine
+    mt19937 impulse_generator(19);
+    normal_distribution<double> impulse_distribution(0.0, 1.0);
+    vector<double> reverb_impulse_response(size_t(0.5 * SAMPLE_RATE));
+    for (size_t tap_index = 0; tap_index < reverb_impulse_response.size(); tap_index++) {
+        reverb_impulse_response[tap_index] = 0.05 * impulse_distribution(impulse_generator) *
+                                             exp(-6.9 * tap_index / reverb_impulse_response.size());
+    }
+    
+    // The system streams a click train through the convolver in standard-size blocks
+    partitioned_convolver_state convolver_state = initialize_partitioned_convolver(reverb_impulse_response, 1);
+    audio_processing_buffer convolution_audio_buffer;
+    convolution_audio_buffer.channel_count = 1;
+    convolution_audio_buffer.sample_data_array.resize(AUDIO_BUFFER_SIZE);
+    const int convolution_blocks = 64;
+    vector<double> convolution_input(size_t(convolution_blocks) * AUDIO_BUFFER_SIZE, 0.0);
+    vector<double> convolution_output(convolution_input.size(), 0.0);
+    for (size_t click_index = 100; click_index < convolution_input.size(); click_index += 9000) {
+        convolution_input[click_index] = 1.0;
+    }
+    auto convolution_start = chrono::high_resolution_clock::now();
+    for (int block_index = 0; block_index < convolution_blocks; block_index++) {
+        copy(convolution_input.begin() + size_t(block_index) * AUDIO_BUFFER_SIZE,
+             convolution_input.begin() + size_t(block_index + 1) * AUDIO_BUFFER_SIZE,
+             convolution_audio_buffer.sample_data_array.begin());
+        apply_partitioned_convolver(convolution_audio_buffer, convolver_state);
+        copy(convolution_audio_buffer.sample_data_array.begin(), convolution_audio_buffer.sample_data_array.end(),
+             convolution_output.begin() + size_t(block_index) * AUDIO_BUFFER_SIZE);
+    }
+    auto convolution_end = chrono::high_resolution_clock::now();
+    
+    // The system checks the whole streamed output, every partition and the decaying tail, against direct convolution
+    double maximum_convolution_error = 0.0;
+    for (size_t output_index = AUDIO_BUFFER_SIZE; output_index < convolution_output.size(); output_index++) {
+        double direct_value = 0.0;
+        size_t source_end = output_index - AUDIO_BUFFER_SIZE;
+        for (size_t tap_index = 0; tap_index <= source_end && tap_index < reverb_impulse_response.size(); tap_index++) {
+            direct_value += reverb_impulse_response[tap_index] * convolution_input[source_end - tap_index];
+        }
+        maximum_convolution_error = max(maximum_convolution_error, abs(direct_value - convolution_output[output_index]));
+    }
+    double convolution_microseconds = chrono::duration<double, micro>(convolution_end - convolution_start).count();
+    
+    cout << "\nPARTITIONED CONVOLUTION ENGINE:\n";
+    cout << string(50, '-') << "\n";
+    cout << "Impulse Response: " << reverb_impulse_response.size() << " taps in "
+         << convolver_state.partition_count << " partitions of " << convolver_state.block_size << " frames\n";
+    cout << "Latency: " << convolver_state.block_size << " frames (" << setprecision(2)
+         << convolver_state.block_size * 1000.0 / SAMPLE_RATE << " ms)\n";
+    cout << "Average Block Cost: " << convolution_microseconds / convolution_blocks << " microseconds | Real-Time Factor: "
+         << (convolution_blocks * AUDIO_BUFFER_SIZE / SAMPLE_RATE * 1e6) / convolution_microseconds << "x\n";
+    cout << "Maximum Deviation from Direct Convolution: " << scientific << setprecision(3)
+         << maximum_convolution_error << fixed << "\n";
+    
+    // The system converts one second of a 1 kHz tone from each supported source rate
+    cout << "\nPOLYPHASE SAMPLE-RATE CONVERSION:\n";
+    cout << string(50, '-') << "\n";
+    const int source_rates_hz[4] = {32000, 48000, 88200, 96000};
+    for (int source_rate_hz : source_rates_hz) {
+        polyphase_resampler_state resampler_state = initialize_polyphase_resampler(source_rate_hz, int(SAMPLE_RATE), 1);
+        const polyphase_filter_bank& filter_bank = *resampler_state.filter_bank;
+        audio_processing_buffer source_block;
+        audio_processing_buffer converted_block;
+        source_block.channel_count = 1;
+        source_block.sample_data_array.resize(AUDIO_BUFFER_SIZE);
+        vector<double> converted_signal;
+        converted_signal.reserve(size_t(SAMPLE_RATE) + AUDIO_BUFFER_SIZE);
+    
+        auto resampling_start = chrono::high_resolution_clock::now();
+        for (int block_start = 0; block_start < source_rate_hz; block_start += AUDIO_BUFFER_SIZE) {
+            for (int frame_index = 0; frame_index < AUDIO_BUFFER_SIZE; frame_index++) {
+                source_block.sample_data_array[frame_index] =
+                    0.5 * sin(2.0 * M_PI * 1000.0 * (block_start + frame_index) / source_rate_hz);
+            }
+            resample_audio_block(resampler_state, source_block, converted_block);
+            converted_signal.insert(converted_signal.end(), converted_block.sample_data_array.begin(),
+                                    converted_block.sample_data_array.end());
+        }
+        auto resampling_end = chrono::high_resolution_clock::now();
+    
+        // The system compares the settled output with the ideal tone delayed by the filter group delay
+        double group_delay_seconds = 0.5 * (filter_bank.interpolation_factor * POLYPHASE_TAPS_PER_PHASE - 1) /
+                                     (double(filter_bank.interpolation_factor) * source_rate_hz);
+        double signal_energy = 0.0;
+        double error_energy = 0.0;
+        for (size_t output_index = 2048; output_index + 2048 < converted_signal.size(); output_index++) {
+            double ideal_value = 0.5 * sin(2.0 * M_PI * 1000.0 * (output_index / SAMPLE_RATE - group_delay_seconds));
+            signal_energy += ideal_value * ideal_value;
+            error_energy += (converted_signal[output_index] - ideal_value) * (converted_signal[output_index] - ideal_value);
+        }
+        double resampling_seconds = chrono::duration<double>(resampling_end - resampling_start).count();
+        double processed_seconds = ceil(double(source_rate_hz) / AUDIO_BUFFER_SIZE) * AUDIO_BUFFER_SIZE / source_rate_hz;
+    
+        cout << setw(6) << source_rate_hz << " Hz -> " << int(SAMPLE_RATE) << " Hz | Ratio "
+             << filter_bank.interpolation_factor << "/" << filter_bank.decimation_factor
+             << " | SNR: " << setprecision(1) << 10.0 * log10(signal_energy / max(error_energy, 1e-30)) << " dB"
+             << " | Real-Time Factor: " << setprecision(0) << processed_seconds / max(resampling_seconds, 1e-9) << "x\n";
+    }
+    
+    // The system previews a two-second 440 Hz tone through each stretch configuration
+    cout << "\nTIME-STRETCH AND PITCH-SHIFT PREVIEW:\n";
+    cout << string(50, '-') << "\n";
+    struct stretch_preview_case { const char* case_label; time_stretch_mode stretch_mode; double tempo_ratio; double pitch_ratio;
+                                  double second_half_tempo_ratio; };
+    const stretch_preview_case preview_cases[5] = {
+        {"WSOLA 1.50x tempo       ", STRETCH_WSOLA, 1.5, 1.0, 1.5},
+        {"WSOLA 0.75x tempo       ", STRETCH_WSOLA, 0.75, 1.0, 0.75},
+        {"WSOLA 1.00x then 2.00x  ", STRETCH_WSOLA, 1.0, 1.0, 2.0},
+        {"Vocoder 0.80x tempo     ", STRETCH_PHASE_VOCODER, 0.8, 1.0, 0.8},
+        {"Vocoder +3 semitones    ", STRETCH_PHASE_VOCODER, 1.0, pow(2.0, 3.0 / 12.0), 1.0}
+    };
+    const int preview_blocks = int(2.0 * SAMPLE_RATE) / AUDIO_BUFFER_SIZE;
+    for (const stretch_preview_case& preview_case : preview_cases) {
+        time_stretch_state stretch_state = initialize_time_stretcher(preview_case.stretch_mode, preview_case.tempo_ratio,
+                                                                     preview_case.pitch_ratio, 1);
+        audio_processing_buffer preview_input;
+        audio_processing_buffer preview_output;
+        preview_input.channel_count = 1;
+        preview_input.sample_data_array.resize(AUDIO_BUFFER_SIZE);
+        vector<double> preview_signal;
+    
+        auto stretch_start = chrono::high_resolution_clock::now();
+        for (int block_index = 0; block_index < preview_blocks; block_index++) {
+            if (block_index == preview_blocks / 2) {
+                set_time_stretch_tempo(stretch_state, preview_case.second_half_tempo_ratio);
+            }
+            for (int frame_index = 0; frame_index < AUDIO_BUFFER_SIZE; frame_index++) {
+                preview_input.sample_data_array[frame_index] =
+                    0.5 * sin(2.0 * M_PI * 440.0 * (block_index * AUDIO_BUFFER_SIZE + frame_index) / SAMPLE_RATE);
+            }
+            process_time_stretch_block(stretch_state, preview_input, preview_output);
+            preview_signal.insert(preview_signal.end(), preview_output.sample_data_array.begin(),
+                                  preview_output.sample_data_array.end());
+        }
+        auto stretch_end = chrono::high_resolution_clock::now();
+    
+        double input_seconds = preview_blocks * AUDIO_BUFFER_SIZE / SAMPLE_RATE;
+        double stretch_seconds = chrono::duration<double>(stretch_end - stretch_start).count();
+        vector<double> settled_signal(preview_signal.begin() + min<size_t>(preview_signal.size(), 4096), preview_signal.end());
+        cout << preview_case.case_label << " | Output: " << setprecision(2) << preview_signal.size() / SAMPLE_RATE
+             << " s (expected " << 0.5 * input_seconds / preview_case.tempo_ratio +
+                                    0.5 * input_seconds / preview_case.second_half_tempo_ratio << " s minus latency)"
+             << " | Pitch: " << setprecision(1) << estimate_zero_crossing_frequency(settled_signal) << " Hz"
+             << " | Real-Time Factor: " << setprecision(0) << input_seconds / max(stretch_seconds, 1e-9) << "x\n";
+    }
+    
+    // The system prepares sixty-four stereo streams with staggered gain ramps for the mixer benchmark
+    const int mixer_stream_count = 64;
+    const int mixer_iterations = 200;
+    vector<audio_processing_buffer> mixer_input_buffers(mixer_stream_count);
+    vector<const audio_processing_buffer*> mixer_inputs;
+    audio_mixer_state mixer_state = initialize_audio_mixer(mixer_stream_count, SATURATION_SOFT);
+    for (int stream_index = 0; stream_index < mixer_stream_count; stream_index++) {
+        audio_processing_buffer& stream_buffer = mixer_input_buffers[stream_index];
+        stream_buffer.channel_count = 2;
+        stream_buffer.sample_data_array.resize(2 * AUDIO_BUFFER_SIZE);
+        for (size_t sample_index = 0; sample_index < stream_buffer.sample_data_array.size(); sample_index++) {
+            stream_buffer.sample_data_array[sample_index] = 0.1 * sin(0.001 * (stream_index + 1) * sample_index);
+        }
+        mixer_state.target_gain[stream_index] = 0.25 + 0.5 * (stream_index % 4) / 3.0;
+        mixer_inputs.push_back(&stream_buffer);
+    }
+    
+    // The system times the tiled mixer over repeated blocks
+    audio_processing_buffer mixed_output;
+    auto mixing_start = chrono::high_resolution_clock::now();
+    for (int iteration_index = 0; iteration_index < mixer_iterations; iteration_index++) {
+        mix_audio_streams(mixer_state, mixer_inputs, mixed_output);
+    }
+    auto mixing_end = chrono::high_resolution_clock::now();
+    measure_audio_buffer_levels(mixed_output);
+    
+    double mixing_seconds = chrono::duration<double>(mixing_end - mixing_start).count();
+    double bytes_read = double(mixer_iterations) * mixer_stream_count * 2 * AUDIO_BUFFER_SIZE * sizeof(double);
+    cout << "\nN-STREAM MIXER:\n";
+    cout << string(50, '-') << "\n";
+    cout << "Streams Mixed: " << mixer_stream_count << " stereo | Streams per Pass: " << MIXER_STREAMS_PER_PASS
+         << " | Tile: " << MIXER_TILE_FRAMES << " frames\n";
+    cout << "Average Block Cost: " << setprecision(2) << mixing_seconds * 1e6 / mixer_iterations << " microseconds"
+         << " | Input Throughput: " << bytes_read / max(mixing_seconds, 1e-9) / 1e9 << " GB/s\n";
+    cout << "Soft-Saturated Output Peak: " << setprecision(4) << mixed_output.peak_amplitude_level << "\n";
+    
+    // The system round-trips the stereo stream through every stored format and measures the error
+    cout << "\nSAMPLE FORMAT CONVERSION:\n";
+    cout << string(50, '-') << "\n";
+    const sample_storage_format round_trip_formats[3] = {SAMPLE_FORMAT_FLOAT32, SAMPLE_FORMAT_INT24, SAMPLE_FORMAT_INT16};
+    const char* round_trip_labels[3] = {"float32", "int24  ", "int16  "};
+    vector<uint8_t> stored_samples;
+    audio_processing_buffer restored_buffer;
+    for (int format_index = 0; format_index < 3; format_index++) {
+        export_buffer_to_samples(stereo_audio_buffer, round_trip_formats[format_index], true, stored_samples);
+        import_samples_to_buffer(stored_samples.data(), round_trip_formats[format_index], AUDIO_BUFFER_SIZE, 2, true,
+                                 restored_buffer);
+        double maximum_round_trip_error = 0.0;
+        for (size_t sample_index = 0; sample_index < restored_buffer.sample_data_array.size(); sample_index++) {
+            maximum_round_trip_error = max(maximum_round_trip_error, abs(restored_buffer.sample_data_array[sample_index] -
+                                                                         stereo_audio_buffer.sample_data_array[sample_index]));
+        }
+        cout << "Interleaved " << round_trip_labels[format_index] << " Round Trip | Maximum Error: " << scientific
+             << setprecision(3) << maximum_round_trip_error << fixed << "\n";
+    }
+    
+    // The system measures the spectrum-weighted benefit of noise shaping on a quiet tone reduced to 16-bit
+    audio_processing_buffer quiet_buffer;
+    quiet_buffer.channel_count = 1;
+    quiet_buffer.sample_data_array.resize(16 * AUDIO_BUFFER_SIZE);
+    for (size_t sample_index = 0; sample_index < quiet_buffer.sample_data_array.size(); sample_index++) {
+        quiet_buffer.sample_data_array[sample_index] = 0.001 * sin(2.0 * M_PI * 1000.0 * sample_index / SAMPLE_RATE);
+    }
+    const char* dither_labels[3] = {"Plain rounding  ", "TPDF dither     ", "TPDF + shaping  "};
+    for (int dither_mode = 0; dither_mode < 3; dither_mode++) {
+        dither_generator_state dither_state = initialize_dither_generator(1, dither_mode >= 1, dither_mode == 2);
+        export_buffer_to_samples(quiet_buffer, SAMPLE_FORMAT_INT16, false, stored_samples,
+                                 dither_mode == 0 ? nullptr : &dither_state);
+        import_samples_to_buffer(stored_samples.data(), SAMPLE_FORMAT_INT16, int(quiet_buffer.sample_data_array.size()), 1,
+                                 false, restored_buffer);
+    
+        // The system low-passes the error with a short moving average to estimate in-band noise
+        double error_energy = 0.0;
+        double in_band_energy = 0.0;
+        double smoothed_error = 0.0;
+        for (size_t sample_index = 0; sample_index < restored_buffer.sample_data_array.size(); sample_index++) {
+            double quantisation_error = restored_buffer.sample_data_array[sample_index] - quiet_buffer.sample_data_array[sample_index];
+            smoothed_error += 0.1 * (quantisation_error - smoothed_error);
+            error_energy += quantisation_error * quantisation_error;
+            in_band_energy += smoothed_error * smoothed_error;
+        }
+        size_t sample_total = restored_buffer.sample_data_array.size();
+        cout << dither_labels[dither_mode] << "| Total Error: " << setprecision(1)
+             << 10.0 * log10(error_energy / sample_total + 1e-30) << " dBFS | Low-Band Error: "
+             << 10.0 * log10(in_band_energy / sample_total + 1e-30) << " dBFS\n";
+    }
+    
+    // The system times float64 to interleaved int16 conversion with dither at the ingest edge
+    dither_generator_state throughput_dither = initialize_dither_generator(2, true, false);
+    auto conversion_start = chrono::high_resolution_clock::now();
+    for (int iteration_index = 0; iteration_index < 200; iteration_index++) {
+        export_buffer_to_samples(mixed_output, SAMPLE_FORMAT_INT16, true, stored_samples, &throughput_dither);
+    }
+    auto conversion_end = chrono::high_resolution_clock::now();
+    double conversion_seconds = chrono::duration<double>(conversion_end - conversion_start).count();
+    cout << "Dithered int16 Export Throughput: " << setprecision(1)
+         << 200.0 * mixed_output.sample_data_array.size() / max(conversion_seconds, 1e-9) / 1e6 << " Msamples/s\n";
+    
+    // The system denoises a field recording with hiss throughout and a tone in the middle second
+    cout << "\nSPECTRAL NOISE REDUCTION:\n";
+    cout << string(50, '-') << "\n";
+    const int field_recording_blocks = int(2.0 * SAMPLE_RATE) / AUDIO_BUFFER_SIZE;
+    const noise_reduction_method reduction_methods[2] = {NOISE_SPECTRAL_SUBTRACTION, NOISE_WIENER_GAIN};
+    const char* reduction_labels[2] = {"Spectral subtraction", "Wiener gain         "};
+    silence_detector_configuration noise_gate_configuration = {-30.0, 0.0};
+    for (int method_index = 0; method_index < 2; method_index++) {
+        noise_reducer_state reducer_state = initialize_noise_reducer(reduction_methods[method_index], 1, noise_gate_configuration);
+        mt19937 hiss_generator(37);
+        uniform_real_distribution<double> hiss_distribution(-0.015, 0.015);
+        audio_processing_buffer field_block;
+        field_block.channel_count = 1;
+        field_block.sample_data_array.resize(AUDIO_BUFFER_SIZE);
+        double input_noise_energy = 0.0;
+        double output_noise_energy = 0.0;
+        double output_tone_energy = 0.0;
+        long long tone_sample_total = 0;
+        for (int block_index = 0; block_index < field_recording_blocks; block_index++) {
+            double block_time = block_index * AUDIO_BUFFER_SIZE / SAMPLE_RATE;
+            bool tone_block = block_time >= 0.5 && block_time < 1.5;
+            for (int frame_index = 0; frame_index < AUDIO_BUFFER_SIZE; frame_index++) {
+                double sample_time = (block_index * AUDIO_BUFFER_SIZE + frame_index) / SAMPLE_RATE;
+                double hiss_sample = hiss_distribution(hiss_generator);
+                field_block.sample_data_array[frame_index] = hiss_sample +
+                    (tone_block ? 0.3 * sin(2.0 * M_PI * 500.0 * sample_time) : 0.0);
+                if (block_time >= 1.7) {
+                    input_noise_energy += hiss_sample * hiss_sample;
+                }
+            }
+            apply_noise_reduction(field_block, reducer_state);
+    
+            // The system measures output levels away from the one-frame latency boundaries
+            for (double sample_value : field_block.sample_data_array) {
+                if (block_time >= 1.7) {
+                    output_noise_energy += sample_value * sample_value;
+                } else if (block_time >= 0.8 && block_time < 1.3) {
+                    output_tone_energy += sample_value * sample_value;
+                    tone_sample_total++;
+                }
+            }
+        }
+        cout << reduction_labels[method_index] << " | Noise Frames Learned: " << reducer_state.learned_frame_count
+             << " | Hiss Reduction: " << setprecision(1)
+             << 10.0 * log10(input_noise_energy / max(output_noise_energy, 1e-30)) << " dB"
+             << " | Tone RMS Retained: " << setprecision(4) << sqrt(output_tone_energy / max(1LL, tone_sample_total)) << "\n";
+    }
+    
+    // The system benchmarks fused chains against separate passes over a buffer larger than cache
+    cout << "\nFUSED DSP CHAIN BENCHMARK:\n";
+    cout << string(50, '-') << "\n";
+    vector<double> benchmark_samples(size_t(1) << 22);
+    for (size_t sample_index = 0; sample_index < benchmark_samples.size(); sample_index++) {
+        benchmark_samples[sample_index] = 0.8 * sin(0.0123 * sample_index);
+    }
+    constexpr biquad_coefficients benchmark_filter = design_biquad_coefficients({BIQUAD_LOW_PASS, 8000.0, 0.707, 0.0});
+    double benchmark_peak = 0.0;
+    double benchmark_rms = 0.0;
+    auto time_benchmark_pass = [&](auto&& benchmark_body) {
+        auto benchmark_start = chrono::high_resolution_clock::now();
+        benchmark_body();
+        return chrono::duration<double, milli>(chrono::high_resolution_clock::now() - benchmark_start).count();
+    };
+    
+    double single_stage_ms = time_benchmark_pass([&] {
+        peak_statistic_stage peak_only;
+        peak_only.peak_target = &benchmark_peak;
+        auto single_chain = gain_stage{} | peak_only;
+        run_fused_chain(single_chain, benchmark_samples.data(), int(benchmark_samples.size()));
+    });
+    double fused_five_stage_ms = time_benchmark_pass([&] {
+        gain_stage input_gain;
+        biquad_stage tone_filter;
+        hard_clip_stage output_clip;
+        peak_statistic_stage peak_meter;
+        rms_statistic_stage rms_meter;
+        input_gain.gain_factor = 0.9;
+        tone_filter.coefficients = benchmark_filter;
+        output_clip.ceiling_level = 0.7;
+        peak_meter.peak_target = &benchmark_peak;
+        rms_meter.rms_target = &benchmark_rms;
+        auto five_stage_chain = input_gain | tone_filter | output_clip | peak_meter | rms_meter;
+        run_fused_chain(five_stage_chain, benchmark_samples.data(), int(benchmark_samples.size()));
+    });
+    double separate_passes_ms = time_benchmark_pass([&] {
+        gain_stage input_gain;
+        biquad_stage tone_filter;
+        hard_clip_stage output_clip;
+        peak_statistic_stage peak_meter;
+        rms_statistic_stage rms_meter;
+        input_gain.gain_factor = 0.9;
+        tone_filter.coefficients = benchmark_filter;
+        output_clip.ceiling_level = 0.7;
+        peak_meter.peak_target = &benchmark_peak;
+        rms_meter.rms_target = &benchmark_rms;
+        run_fused_chain(input_gain, benchmark_samples.data(), int(benchmark_samples.size()));
+        run_fused_chain(tone_filter, benchmark_samples.data(), int(benchmark_samples.size()));
+        run_fused_chain(output_clip, benchmark_samples.data(), int(benchmark_samples.size()));
+        run_fused_chain(peak_meter, benchmark_samples.data(), int(benchmark_samples.size()));
+        run_fused_chain(rms_meter, benchmark_samples.data(), int(benchmark_samples.size()));
+    });
+    double fused_benchmark_peak = benchmark_peak;
+    double fused_benchmark_rms = benchmark_rms;
+    
+    // The system repeats the comparison with light element-wise stages, where memory bandwidth rather than the
+    // serial biquad recursion bounds each pass
+    double light_fused_ms = time_benchmark_pass([&] {
+        gain_stage trim_gain;
+        hard_clip_stage safety_clip;
+        gain_stage output_gain;
+        trim_gain.gain_factor = 1.1;
+        safety_clip.ceiling_level = 0.75;
+        output_gain.gain_factor = 0.95;
+        auto light_chain = trim_gain | safety_clip | output_gain;
+        run_fused_chain(light_chain, benchmark_samples.data(), int(benchmark_samples.size()));
+    });
+    double light_separate_ms = time_benchmark_pass([&] {
+        gain_stage trim_gain;
+        hard_clip_stage safety_clip;
+        gain_stage output_gain;
+        trim_gain.gain_factor = 1.1;
+        safety_clip.ceiling_level = 0.75;
+        output_gain.gain_factor = 0.95;
+        run_fused_chain(trim_gain, benchmark_samples.data(), int(benchmark_samples.size()));
+        run_fused_chain(safety_clip, benchmark_samples.data(), int(benchmark_samples.size()));
+        run_fused_chain(output_gain, benchmark_samples.data(), int(benchmark_samples.size()));
+    });
+    
+    // The system reports measured wall time and the bandwidth each variant actually sustained over its passes
+    double buffer_megabytes = benchmark_samples.size() * sizeof(double) / 1e6;
+    auto report_benchmark_row = [&](const char* row_label, double elapsed_ms, int buffer_passes) {
+        cout << row_label << setprecision(2) << elapsed_ms << " ms | Passes: " << buffer_passes
+             << " | ns/sample: " << elapsed_ms * 1e6 / benchmark_samples.size()
+             << " | Sustained Read+Write: " << setprecision(1)
+             << 2.0 * buffer_passes * buffer_megabytes / max(elapsed_ms, 1e-9) << " GB/s\n";
+    };
+    cout << "Benchmark Buffer: " << benchmark_samples.size() << " samples ("
+         << setprecision(1) << buffer_megabytes << " MB)\n";
+    report_benchmark_row("1-Stage Fused Chain:         ", single_stage_ms, 1);
+    report_benchmark_row("5-Stage Fused Chain:         ", fused_five_stage_ms, 1);
+    report_benchmark_row("5 Separate Passes:           ", separate_passes_ms, 5);
+    report_benchmark_row("3 Light Stages Fused:        ", light_fused_ms, 1);
+    report_benchmark_row("3 Light Stages Separate:     ", light_separate_ms, 3);
+    cout << "Fused Chain Output Peak: " << setprecision(4) << fused_benchmark_peak << " | RMS: " << fused_benchmark_rms << "\n";
+    
+    // The system generates two seconds of every test signal family into pooled stereo blocks
+    cout << "\nTEST SIGNAL GENERATOR SUITE:\n";
+    cout << string(50, '-') << "\n";
+    audio_block_pool signal_block_pool = create_audio_block_pool(4, 2, AUDIO_BUFFER_SIZE);
+    const test_signal_specification signal_specifications[7] = {
+        {SIGNAL_LOG_SWEEP, 0.5, 20.0, 20000.0, 2.0, 0, 0, 0.0, 0.0, 39},
+        {SIGNAL_MULTITONE, 0.8, 50.0, 16000.0, 0.0, 31, 0, 0.0, 0.0, 39},
+        {SIGNAL_IMPULSE_TRAIN, 1.0, 0.0, 0.0, 0.0, 0, 4410, 0.0, 0.0, 39},
+        {SIGNAL_WHITE_NOISE, 0.5, 0.0, 0.0, 0.0, 0, 0, 0.0, 0.0, 39},
+        {SIGNAL_PINK_NOISE, 0.5, 0.0, 0.0, 0.0, 0, 0, 0.0, 0.0, 39},
+        {SIGNAL_BROWN_NOISE, 0.5, 0.0, 0.0, 0.0, 0, 0, 0.1, 0.0, 39},
+        {SIGNAL_WHITE_NOISE, 1.5, 0.0, 0.0, 0.0, 0, 0, 0.0, 1.0, 39}
+    };
+    const char* signal_labels[7] = {"Log sweep 20 Hz-20 kHz ", "Multitone (31 tones)   ", "Impulse train (10 Hz)  ",
+                                    "White noise            ", "Pink noise             ", "Brown noise + DC 0.1   ",
+                                    "White noise clipped    "};
+    const int signal_blocks = int(2.0 * SAMPLE_RATE) / AUDIO_BUFFER_SIZE;
+    for (int signal_index = 0; signal_index < 7; signal_index++) {
+        test_signal_generator_state generator_state = initialize_test_signal_generator(signal_specifications[signal_index], 2);
+        double signal_peak = 0.0;
+        double signal_dc = 0.0;
+        long long clipped_samples = 0;
+        double generation_seconds = 0.0;
+        for (int block_index = 0; block_index < signal_blocks; block_index++) {
+            audio_processing_buffer* pooled_block = acquire_pooled_block(signal_block_pool);
+            auto generation_start = chrono::high_resolution_clock::now();
+            generate_test_signal_block(generator_state, *pooled_block);
+            generation_seconds += chrono::duration<double>(chrono::high_resolution_clock::now() - generation_start).count();
+            measure_audio_buffer_levels(*pooled_block);
+            signal_peak = max(signal_peak, pooled_block->peak_amplitude_level);
+            signal_dc += pooled_block->dc_offset_level / signal_blocks;
+            clipped_samples += detect_clipping_events(*pooled_block, clipping_configuration).full_scale_sample_count;
+            release_pooled_block(signal_block_pool, pooled_block);
+        }
+        cout << signal_labels[signal_index] << "| Peak: " << setprecision(3) << signal_peak << " | DC: " << signal_dc
+             << " | Full-Scale Samples: " << clipped_samples << " | Generation: " << setprecision(0)
+             << 2.0 * signal_blocks * AUDIO_BUFFER_SIZE / max(generation_seconds, 1e-9) / 1e6 << " Msamples/s\n";
+    }
+    
+    // The system confirms that identical seeds reproduce identical noise
+    test_signal_generator_state first_noise = initialize_test_signal_generator(signal_specifications[3], 2);
+    test_signal_generator_state second_noise = initialize_test_signal_generator(signal_specifications[3], 2);
+    audio_processing_buffer* first_block = acquire_pooled_block(signal_block_pool);
+    audio_processing_buffer* second_block = acquire_pooled_block(signal_block_pool);
+    generate_test_signal_block(first_noise, *first_block);
+    generate_test_signal_block(second_noise, *second_block);
+    cout << "Seeded Determinism: " << (first_block->sample_data_array == second_block->sample_data_array ?
+                                       "identical output for identical seeds" : "MISMATCH") << "\n";
+    release_pooled_block(signal_block_pool, second_block);
+    release_pooled_block(signal_block_pool, first_block);
+    
+    // The system checks the baked tables against runtime evaluation and times the constant-size kernel
+    cout << "\nCOMPILE-TIME TABLES:\n";
+    cout << string(50, '-') << "\n";
+    double window_table_error = 0.0;
+    double twiddle_table_error = 0.0;
+    for (int sample_index = 0; sample_index < AUDIO_BUFFER_SIZE; sample_index++) {
+        double cycle_angle = 2.0 * M_PI * sample_index / AUDIO_BUFFER_SIZE;
+        double kaiser_position = 2.0 * sample_index / (AUDIO_BUFFER_SIZE - 1) - 1.0;
+        window_table_error = max({window_table_error,
+            fabs(HANN_WINDOW_TABLE[sample_index] - (0.5 - 0.5 * cos(cycle_angle))),
+            fabs(HAMMING_WINDOW_TABLE[sample_index] - (0.54 - 0.46 * cos(cycle_angle))),
+            fabs(BLACKMAN_HARRIS_WINDOW_TABLE[sample_index] - (0.35875 - 0.48829 * cos(cycle_angle) +
+                                                               0.14128 * cos(2.0 * cycle_angle) - 0.01168 * cos(3.0 * cycle_angle))),
+            fabs(KAISER_WINDOW_TABLE[sample_index] - modified_bessel_i0(8.6 * sqrt(1.0 - kaiser_position * kaiser_position)) /
+                                                     modified_bessel_i0(8.6)),
+            fabs(SQRT_HANN_WINDOW_TABLE[sample_index] - sin(0.5 * cycle_angle))});
+        double twiddle_angle = -2.0 * M_PI * sample_index / COMPILE_TIME_FFT_SIZE;
+        twiddle_table_error = max({twiddle_table_error, fabs(FFT_TWIDDLE_REAL_TABLE[sample_index] - cos(twiddle_angle)),
+                                   fabs(FFT_TWIDDLE_IMAG_TABLE[sample_index] - sin(twiddle_angle))});
+    }
+    cout << "Window Tables (5 x " << AUDIO_BUFFER_SIZE << ") Max Error: " << scientific << setprecision(2) << window_table_error
+         << " | Twiddle Table (" << COMPILE_TIME_FFT_SIZE / 2 << ") Max Error: " << twiddle_table_error << fixed << "\n";
+    cout << "Baked Low-Pass Biquad: b0=" << setprecision(6) << benchmark_filter.b0 << " a1=" << benchmark_filter.a1
+         << " | Runtime Design Difference: " << scientific << setprecision(2)
+         << fabs(benchmark_filter.a1 - (-2.0 * cos(2.0 * M_PI * 8000.0 / SAMPLE_RATE)) /
+                                       (1.0 + sin(2.0 * M_PI * 8000.0 / SAMPLE_RATE) / (2.0 * 0.707))) << fixed << "\n";
+    
+    const fft_transform_plan& kernel_plan = acquire_fft_plan(COMPILE_TIME_FFT_SIZE);
+    vector<double> kernel_real(COMPILE_TIME_FFT_SIZE);
+    vector<double> kernel_imag(COMPILE_TIME_FFT_SIZE);
+    vector<double> planned_real(COMPILE_TIME_FFT_SIZE);
+    vector<double> planned_imag(COMPILE_TIME_FFT_SIZE);
+    for (int point_index = 0; point_index < COMPILE_TIME_FFT_SIZE; point_index++) {
+        kernel_real[point_index] = planned_real[point_index] = sin(0.37 * point_index) + 0.25 * cos(1.91 * point_index);
+        kernel_imag[point_index] = planned_imag[point_index] = 0.0;
+    }
+    const int kernel_repetitions = 2000;
+    auto fixed_start = chrono::high_resolution_clock::now();
+    for (int repetition_index = 0; repetition_index < kernel_repetitions; repetition_index++) {
+        execute_fixed_size_fft<COMPILE_TIME_FFT_SIZE>(kernel_real.data(), kernel_imag.data(), repetition_index % 2 == 1);
+    }
+    double fixed_kernel_ms = chrono::duration<double, milli>(chrono::high_resolution_clock::now() - fixed_start).count();
+    auto planned_start = chrono::high_resolution_clock::now();
+    for (int repetition_index = 0; repetition_index < kernel_repetitions; repetition_index++) {
+        execute_planned_fft(kernel_plan, planned_real.data(), planned_imag.data(), repetition_index % 2 == 1);
+    }
+    double planned_kernel_ms = chrono::duration<double, milli>(chrono::high_resolution_clock::now() - planned_start).count();
+    double kernel_difference = 0.0;
+    for (int point_index = 0; point_index < COMPILE_TIME_FFT_SIZE; point_index++) {
+        kernel_difference = max(kernel_difference, fabs(kernel_real[point_index] - planned_real[point_index]));
+    }
+    cout << COMPILE_TIME_FFT_SIZE << "-Point FFT x" << kernel_repetitions << ": Fixed-Size " << setprecision(1) << fixed_kernel_ms
+         << " ms | Plan-Driven " << planned_kernel_ms << " ms | Max Difference: " << scientific << setprecision(2)
+         << kernel_difference << fixed << "\n";
+    
+    // The system streams a synthetic note sequence over decaying noise and scores both novelty functions
+    cout << "\nONSET DETECTION ANALYSIS:\n";
+    cout << string(50, '-') << "\n";
+    const int onset_blocks = int(8.0 * SAMPLE_RATE) / AUDIO_BUFFER_SIZE;
+    vector<double> true_onset_times;
+    vector<double> note_frequencies;
+    mt19937 note_generator(41);
+    for (double note_time = 0.31; note_time < 7.5; note_time += 0.18 + 0.25 * uniform_real_distribution<double>(0.0, 1.0)(note_generator)) {
+        true_onset_times.push_back(note_time);
+        note_frequencies.push_back(110.0 * pow(2.0, int(uniform_real_distribution<double>(0.0, 36.0)(note_generator)) / 12.0));
+    }
+    test_signal_generator_state background_noise = initialize_test_signal_generator(
+        {SIGNAL_PINK_NOISE, 0.02, 0.0, 0.0, 0.0, 0, 0, 0.0, 0.0, 41}, 1);
+    vector<audio_processing_buffer> onset_blocks_audio(onset_blocks);
+    for (int block_index = 0; block_index < onset_blocks; block_index++) {
+        audio_processing_buffer& note_block = onset_blocks_audio[block_index];
+        note_block.channel_count = 1;
+        note_block.sample_data_array.assign(AUDIO_BUFFER_SIZE, 0.0);
+        generate_test_signal_block(background_noise, note_block);
+        for (int frame_index = 0; frame_index < AUDIO_BUFFER_SIZE; frame_index++) {
+            double sample_time = double(block_index * AUDIO_BUFFER_SIZE + frame_index) / SAMPLE_RATE;
+            for (size_t note_index = 0; note_index < true_onset_times.size(); note_index++) {
+                double note_age = sample_time - true_onset_times[note_index];
+                if (note_age >= 0.0 && note_age < 0.6) {
+                    note_block.sample_data_array[frame_index] += 0.3 * exp(-note_age * 9.0) *
+                                                                 sin(2.0 * M_PI * note_frequencies[note_index] * note_age);
+                }
+            }
+        }
+    }
+    const char* onset_labels[2] = {"Spectral flux  ", "Complex domain "};
+    for (int function_index = 0; function_index < 2; function_index++) {
+        onset_detector_state onset_detector = initialize_onset_detector(
+            {onset_detection_function(function_index), 512, 15, function_index == 0 ? 0.002 : 0.0005, 1.5, 0.05});
+        auto onset_start = chrono::high_resolution_clock::now();
+        for (const audio_processing_buffer& note_block : onset_blocks_audio) {
+            feed_onset_detector(onset_detector, note_block);
+        }
+        finalize_onset_detection(onset_detector);
+        double onset_seconds = chrono::duration<double>(chrono::high_resolution_clock::now() - onset_start).count();
+        int matched_onsets = 0;
+        double timing_error_sum = 0.0;
+        for (double true_time : true_onset_times) {
+            for (double detected_time : onset_detector.onset_times) {
+                if (fabs(detected_time - true_time) <= 0.05) {
+                    matched_onsets++;
+                    timing_error_sum += fabs(detected_time - true_time);
+                    break;
+                }
+            }
+        }
+        cout << onset_labels[function_index] << "| Detected: " << onset_detector.onset_times.size() << " / " << true_onset_times.size()
+             << " | Matched (50 ms): " << matched_onsets << " | Mean Timing Error: " << setprecision(1)
+             << 1000.0 * timing_error_sum / max(1, matched_onsets) << " ms | Real-Time Factor: " << setprecision(0)
+             << onset_blocks * AUDIO_BUFFER_SIZE / SAMPLE_RATE / max(onset_seconds, 1e-9) << "x\n";
+    }
+    
+    // The system tracks tempo and beats over a four-minute synthetic drum pattern at 128 BPM
+    cout << "\nTEMPO AND BEAT TRACKING:\n";
+    cout << string(50, '-') << "\n";
+    const double drum_tempo_bpm = 128.0;
+    const double drum_first_beat = 0.25;
+    const double drum_beat_period = 60.0 / drum_tempo_bpm;
+    const int drum_blocks = int(240.0 * SAMPLE_RATE) / AUDIO_BUFFER_SIZE;
+    onset_detector_state beat_detector = initialize_onset_detector({ONSET_SPECTRAL_FLUX, 512, 15, 0.002, 1.5, 0.05});
+    beat_detector.envelope_recording_enabled = true;
+    onset_detector_state fine_beat_detector = initialize_onset_detector({ONSET_SPECTRAL_FLUX, 128, 15, 0.002, 1.5, 0.05});
+    fine_beat_detector.envelope_recording_enabled = true;
+    test_signal_generator_state hat_noise = initialize_test_signal_generator({SIGNAL_WHITE_NOISE, 1.0, 0.0, 0.0, 0.0, 0, 0, 0.0, 0.0, 42}, 1);
+    audio_processing_buffer drum_block = {vector<double>(AUDIO_BUFFER_SIZE, 0.0), 0.0, 0.0, 0, 1, 0.0};
+    for (int block_index = 0; block_index < drum_blocks; block_index++) {
+        generate_test_signal_block(hat_noise, drum_block);
+        for (int frame_index = 0; frame_index < AUDIO_BUFFER_SIZE; frame_index++) {
+            double sample_time = double(block_index * AUDIO_BUFFER_SIZE + frame_index) / SAMPLE_RATE - drum_first_beat;
+            double beat_phase = sample_time - floor(sample_time / drum_beat_period) * drum_beat_period;
+            double hat_phase = beat_phase - 0.5 * drum_beat_period;
+            double kick_value = (sample_time >= 0.0 && beat_phase < 0.15) ?
+                                0.6 * exp(-beat_phase * 25.0) * sin(2.0 * M_PI * 60.0 * beat_phase) : 0.0;
+            double click_level = (sample_time >= 0.0 && beat_phase < 0.02) ? 0.3 * exp(-beat_phase * 300.0) : 0.0;
+            double hat_level = (sample_time >= 0.0 && hat_phase >= 0.0 && hat_phase < 0.03) ? 0.05 * exp(-hat_phase * 150.0) : 0.0;
+            drum_block.sample_data_array[frame_index] = kick_value + (click_level + hat_level) * drum_block.sample_data_array[frame_index];
+        }
+        feed_onset_detector(beat_detector, drum_block);
+        feed_onset_detector(fine_beat_detector, drum_block);
+    }
+    auto tempo_start = chrono::high_resolution_clock::now();
+    tempo_analysis_report tempo_report = track_tempo_and_beats(beat_detector.novelty_envelope, SAMPLE_RATE / 512.0,
+                                                               (512 - 0.5 * beat_detector.frame_length) / SAMPLE_RATE);
+    double tempo_ms = chrono::duration<double, milli>(chrono::high_resolution_clock::now() - tempo_start).count();
+    int aligned_beats = 0;
+    for (double beat_time : tempo_report.beat_times) {
+        double beat_offset = beat_time - drum_first_beat;
+        double phase_error = beat_offset - round(beat_offset / drum_beat_period) * drum_beat_period;
+        aligned_beats += (fabs(phase_error) <= 0.07) ? 1 : 0;
+    }
+    cout << "Envelope Frames: " << beat_detector.novelty_envelope.size() << " | Estimated Tempo: " << setprecision(2)
+         << tempo_report.tempo_bpm << " BPM (true " << setprecision(0) << drum_tempo_bpm << ") | Confidence: " << setprecision(2)
+         << tempo_report.tempo_confidence << "\n";
+    cout << "Beats Tracked: " << tempo_report.beat_times.size() << " (expected " << int((240.0 - drum_first_beat) / drum_beat_period) + 1
+         << ") | Within 70 ms of Grid: " << aligned_beats << " | First Beats: " << setprecision(3);
+    for (size_t beat_index = 0; beat_index < min<size_t>(4, tempo_report.beat_times.size()); beat_index++) {
+        cout << tempo_report.beat_times[beat_index] << " ";
+    }
+    cout << "s\n";
+    cout << "Tempo + Beat Tracking CPU Time (4-minute track): " << setprecision(2) << tempo_ms << " ms\n";
+    
+    // The system repeats the estimate on a 128-frame hop down to 40 BPM, whose lag range needs a larger transform
+    tempo_analysis_report fine_tempo_report = track_tempo_and_beats(fine_beat_detector.novelty_envelope, SAMPLE_RATE / 128.0,
+                                                                    (128 - 0.5 * fine_beat_detector.frame_length) / SAMPLE_RATE,
+                                                                    40.0, 200.0);
+    cout << "Fine Hop (128 frames, 40-200 BPM) | Envelope Frames: " << fine_beat_detector.novelty_envelope.size()
+         << " | Estimated Tempo: " << setprecision(2) << fine_tempo_report.tempo_bpm << " BPM | Beats Tracked: "
+         << fine_tempo_report.beat_times.size() << "\n";
+    
+    // The system tracks a gliding harmonic voice, a noisy pause and a steady note with both voicing rules
+    cout << "\nPITCH TRACKING ANALYSIS:\n";
+    cout << string(50, '-') << "\n";
+    const int pitch_blocks = int(4.0 * SAMPLE_RATE) / AUDIO_BUFFER_SIZE;
+    auto true_pitch_at = [](double sample_time) {
+        if (sample_time < 2.0) {
+            return 150.0 * pow(2.0, sample_time / 2.0) * (1.0 + 0.01 * sin(2.0 * M_PI * 5.5 * sample_time));
+        }
+        return sample_time < 2.75 ? 0.0 : 440.0;
+    };
+    vector<audio_processing_buffer> pitch_audio(pitch_blocks);
+    test_signal_generator_state breath_noise = initialize_test_signal_generator({SIGNAL_WHITE_NOISE, 0.01, 0.0, 0.0, 0.0, 0, 0, 0.0, 0.0, 43}, 1);
+    double voice_phase = 0.0;
+    for (int block_index = 0; block_index < pitch_blocks; block_index++) {
+        pitch_audio[block_index] = {vector<double>(AUDIO_BUFFER_SIZE, 0.0), 0.0, 0.0, 0, 1, 0.0};
+        generate_test_signal_block(breath_noise, pitch_audio[block_index]);
+        for (int frame_index = 0; frame_index < AUDIO_BUFFER_SIZE; frame_index++) {
+            double fundamental_hz = true_pitch_at(double(block_index * AUDIO_BUFFER_SIZE + frame_index) / SAMPLE_RATE);
+            voice_phase += 2.0 * M_PI * fundamental_hz / SAMPLE_RATE;
+            double voice_value = 0.0;
+            for (int harmonic_index = 1; harmonic_index <= 6 && fundamental_hz > 0.0; harmonic_index++) {
+                voice_value += 0.25 / harmonic_index * sin(harmonic_index * voice_phase);
+            }
+            pitch_audio[block_index].sample_data_array[frame_index] += voice_value;
+        }
+    }
+    const char* pitch_labels[2] = {"YIN  (threshold 0.15)", "pYIN (Beta prior)    "};
+    for (int rule_index = 0; rule_index < 2; rule_index++) {
+        pitch_tracker_state pitch_tracker = initialize_pitch_tracker({60.0, 1000.0, 512, 0.15, rule_index == 1});
+        vector<pitch_frame_estimate> pitch_contour;
+        auto pitch_start = chrono::high_resolution_clock::now();
+        for (const audio_processing_buffer& voice_block : pitch_audio) {
+            feed_pitch_tracker(pitch_tracker, voice_block, pitch_contour);
+        }
+        double pitch_seconds = chrono::duration<double>(chrono::high_resolution_clock::now() - pitch_start).count();
+        int voiced_truth = 0, voiced_hits = 0, false_voicing = 0, gross_errors = 0;
+        double cents_error_sum = 0.0;
+        for (const pitch_frame_estimate& frame_estimate : pitch_contour) {
+            double true_pitch = true_pitch_at(frame_estimate.frame_time);
+            bool stable_truth = fabs(true_pitch_at(frame_estimate.frame_time - 0.025) - true_pitch) < 20.0 &&
+                                fabs(true_pitch_at(frame_estimate.frame_time + 0.025) - true_pitch) < 20.0;
+            if (!stable_truth) {
+                continue;
+            }
+            if (true_pitch > 0.0) {
+                voiced_truth++;
+                if (frame_estimate.voiced_frame) {
+                    voiced_hits++;
+                    double cents_error = fabs(1200.0 * log2(frame_estimate.frequency_hz / true_pitch));
+                    gross_errors += cents_error > 50.0 ? 1 : 0;
+                    cents_error_sum += cents_error <= 50.0 ? cents_error : 0.0;
+                }
+            } else {
+                false_voicing += frame_estimate.voiced_frame ? 1 : 0;
+            }
+        }
+        cout << pitch_labels[rule_index] << "| Frames: " << pitch_contour.size() << " | Voicing Recall: " << setprecision(1)
+             << 100.0 * voiced_hits / max(1, voiced_truth) << "% | False Voicing: " << false_voicing << " | Gross Errors: "
+             << gross_errors << " | Mean Error: " << setprecision(2) << cents_error_sum / max(1, voiced_hits - gross_errors)
+             << " cents | Real-Time Factor: " << setprecision(0) << pitch_blocks * AUDIO_BUFFER_SIZE / SAMPLE_RATE / max(pitch_seconds, 1e-9) << "x\n";
+    }
+    
+    // The system checks a steady 200 Hz tone with strong 2nd and 3rd harmonics, whose shallow early dips must not
+    // take the threshold prior away from the true-period dip
+    vector<audio_processing_buffer> harmonic_audio(pitch_blocks);
+    for (int block_index = 0; block_index < pitch_blocks; block_index++) {
+        harmonic_audio[block_index] = {vector<double>(AUDIO_BUFFER_SIZE, 0.0), 0.0, 0.0, 0, 1, 0.0};
+        for (int frame_index = 0; frame_index < AUDIO_BUFFER_SIZE; frame_index++) {
+            double tone_phase = 2.0 * M_PI * 200.0 * double(block_index * AUDIO_BUFFER_SIZE + frame_index) / SAMPLE_RATE;
+            harmonic_audio[block_index].sample_data_array[frame_index] = 0.2 * sin(tone_phase) + 0.3 * sin(2.0 * tone_phase) +
+                                                                         0.2 * sin(3.0 * tone_phase);
+        }
+    }
+    for (int rule_index = 0; rule_index < 2; rule_index++) {
+        pitch_tracker_state pitch_tracker = initialize_pitch_tracker({60.0, 1000.0, 512, 0.15, rule_index == 1});
+        vector<pitch_frame_estimate> pitch_contour;
+        for (const audio_processing_buffer& tone_block : harmonic_audio) {
+            feed_pitch_tracker(pitch_tracker, tone_block, pitch_contour);
+        }
+        int voiced_frames = 0, on_pitch_frames = 0;
+        double confidence_sum = 0.0;
+        for (const pitch_frame_estimate& frame_estimate : pitch_contour) {
+            voiced_frames += frame_estimate.voiced_frame ? 1 : 0;
+            on_pitch_frames += (frame_estimate.voiced_frame && fabs(frame_estimate.frequency_hz - 200.0) < 1.0) ? 1 : 0;
+            confidence_sum += frame_estimate.voicing_confidence;
+        }
+        cout << pitch_labels[rule_index] << "| Harmonic 200 Hz Tone | Voiced: " << voiced_frames << " / " << pitch_contour.size()
+             << " | At 200 Hz: " << on_pitch_frames << " | Mean Confidence: " << setprecision(2)
+             << confidence_sum / max<size_t>(1, pitch_contour.size()) << "\n";
+    }
+    
+    // The system fingerprints a small synthetic library, writes the inverted index and queries re-encoded excerpts
+    cout << "\nAUDIO FINGERPRINT INDEX:\n";
+    cout << string(50, '-') << "\n";
+    const int library_track_count = 24;
+    const double library_track_seconds = 6.0;
+    auto render_library_track = [](uint32_t track_seed, double track_seconds) {
+        mt19937 note_generator(track_seed);
+        vector<double> note_times, note_pitches;
+        for (double note_time = 0.0; note_time < track_seconds; note_time += 0.12 + 0.25 * uniform_real_distribution<double>(0.0, 1.0)(note_generator)) {
+            note_times.push_back(note_time);
+            note_pitches.push_back(196.0 * pow(2.0, int(uniform_real_distribution<double>(0.0, 24.0)(note_generator)) / 12.0));
+        }
+        vector<double> track_samples(size_t(track_seconds * SAMPLE_RATE), 0.0);
+        for (size_t note_index = 0; note_index < note_times.size(); note_index++) {
+            size_t note_start = size_t(note_times[note_index] * SAMPLE_RATE);
+            size_t note_end = min(track_samples.size(), note_start + size_t(0.4 * SAMPLE_RATE));
+            for (size_t sample_index = note_start; sample_index < note_end; sample_index++) {
+                double note_age = double(sample_index - note_start) / SAMPLE_RATE;
+                double note_envelope = 0.3 * exp(-note_age * 6.0);
+                for (int harmonic_index = 1; harmonic_index <= 3; harmonic_index++) {
+                    track_samples[sample_index] += note_envelope / harmonic_index *
+                                                   sin(2.0 * M_PI * harmonic_index * note_pitches[note_index] * note_age);
+                }
+            }
+        }
+        return track_samples;
+    };
+    auto fingerprint_samples = [](const vector<double>& track_samples) {
+        fingerprint_extractor_state extractor_state = initialize_fingerprint_extractor();
+        vector<fingerprint_landmark> track_landmarks;
+        audio_processing_buffer stream_block = {vector<double>(), 0.0, 0.0, 0, 1, 0.0};
+        for (size_t block_start = 0; block_start < track_samples.size(); block_start += AUDIO_BUFFER_SIZE) {
+            size_t block_end = min(track_samples.size(), block_start + AUDIO_BUFFER_SIZE);
+            stream_block.sample_data_array.assign(track_samples.begin() + block_start, track_samples.begin() + block_end);
+            feed_fingerprint_extractor(extractor_state, stream_block, track_landmarks);
+        }
+        return track_landmarks;
+    };
+    
+    fingerprint_index_builder index_builder;
+    vector<vector<double>> library_tracks;
+    auto extraction_start = chrono::high_resolution_clock::now();
+    for (int track_index = 0; track_index < library_track_count; track_index++) {
+        library_tracks.push_back(render_library_track(4400 + track_index, library_track_seconds));
+        add_track_to_fingerprint_index(index_builder, uint32_t(track_index), fingerprint_samples(library_tracks.back()));
+    }
+    double extraction_seconds = chrono::duration<double>(chrono::high_resolution_clock::now() - extraction_start).count();
+    string fingerprint_index_path = analysis_storage_path("artlest_fingerprint_index.afpx");
+    bool index_written = write_fingerprint_index(index_builder, fingerprint_index_path);
+    fingerprint_index_reader index_reader = open_fingerprint_index(fingerprint_index_path);
+    cout << "Library: " << library_track_count << " tracks | Landmarks: " << index_builder.posting_hashes.size()
+         << " | Index Written: " << (index_written && index_reader.index_ready ? "yes" : "NO") << " | Render + Extract: "
+         << setprecision(2) << extraction_seconds << " s\n";
+    
+    // Queries are 3 s excerpts with gain change, added noise and a dithered 16-bit round trip
+    mt19937 query_generator(44);
+    double query_ms_total = 0.0;
+    int query_count = 0;
+    for (int query_index = 0; query_index < 6; query_index++) {
+        bool unknown_query = (query_index == 5);
+        vector<double> query_source = unknown_query ? render_library_track(9999, 3.0) : library_tracks[query_index * 4];
+        size_t excerpt_start = unknown_query ? 0 : size_t(uniform_real_distribution<double>(0.0, 2.5)(query_generator) * SAMPLE_RATE);
+        audio_processing_buffer query_buffer = {vector<double>(query_source.begin() + excerpt_start,
+                                                               query_source.begin() + excerpt_start + size_t(3.0 * SAMPLE_RATE)),
+                                                0.0, 0.0, 0, 1, 0.0};
+        test_signal_generator_state query_noise = initialize_test_signal_generator({SIGNAL_PINK_NOISE, 0.05, 0.0, 0.0, 0.0, 0, 0, 0.0, 0.0,
+                                                                                    uint64_t(query_index)}, 1);
+        audio_processing_buffer noise_buffer = {vector<double>(query_buffer.sample_data_array.size()), 0.0, 0.0, 0, 1, 0.0};
+        generate_test_signal_block(query_noise, noise_buffer);
+        for (size_t sample_index = 0; sample_index < query_buffer.sample_data_array.size(); sample_index++) {
+            query_buffer.sample_data_array[sample_index] = 0.7 * query_buffer.sample_data_array[sample_index] + noise_buffer.sample_data_array[sample_index];
+        }
+        vector<uint8_t> encoded_query;
+        dither_generator_state query_dither = initialize_dither_generator(1, true, false, 44);
+        export_buffer_to_samples(query_buffer, SAMPLE_FORMAT_INT16, true, encoded_query, &query_dither);
+        import_samples_to_buffer(encoded_query.data(), SAMPLE_FORMAT_INT16, frames_per_channel(query_buffer), 1, true, query_buffer);
+        vector<fingerprint_landmark> query_landmarks = fingerprint_samples(query_buffer.sample_data_array);
+        
+        auto query_start = chrono::high_resolution_clock::now();
+        vector<fingerprint_match> query_matches = query_fingerprint_index(index_reader, query_landmarks, 2);
+        query_ms_total += chrono::duration<double, milli>(chrono::high_resolution_clock::now() - query_start).count();
+        query_count++;
+        int best_votes = query_matches.empty() ? 0 : query_matches[0].aligned_votes;
+        int runner_up_votes = query_matches.size() > 1 ? query_matches[1].aligned_votes : 0;
+        cout << (unknown_query ? "Unknown track       " : ("Track " + to_string(query_index * 4) + " @ " +
+                 to_string(excerpt_start / SAMPLE_RATE).substr(0, 4) + " s    ").substr(0, 20))
+             << "| Best: " << (query_matches.empty() ? string("none") : "track " + to_string(query_matches[0].track_identifier))
+             << " @ " << setprecision(2) << (query_matches.empty() ? 0.0 : query_matches[0].offset_seconds) << " s | Votes: "
+             << best_votes << " vs " << runner_up_votes << " | Verdict: " << (best_votes >= 4 * max(1, runner_up_votes) && best_votes >= 10 ? "match" : "no match")
+             << "\n";
+    }
+    cout << "Average Query Time: " << setprecision(3) << query_ms_total / query_count << " ms\n";
+    filesystem::remove(fingerprint_index_path);
+    
+    // The system embeds the fingerprint library and checks that a re-encoded copy finds its source
+    cout << "\nSIMILARITY SEARCH INDEX:\n";
+    cout << string(50, '-') << "\n";
+    auto embed_samples = [](const vector<double>& track_samples) {
+        track_embedding_state embedding_state = initialize_track_embedding();
+        audio_processing_buffer stream_block = {vector<double>(), 0.0, 0.0, 0, 1, 0.0};
+        for (size_t block_start = 0; block_start < track_samples.size(); block_start += AUDIO_BUFFER_SIZE) {
+            size_t block_end = min(track_samples.size(), block_start + AUDIO_BUFFER_SIZE);
+            stream_block.sample_data_array.assign(track_samples.begin() + block_start, track_samples.begin() + block_end);
+            feed_track_embedding(embedding_state, stream_block);
+        }
+        return finalize_track_embedding(embedding_state);
+    };
+    hnsw_index library_index = initialize_hnsw_index(TRACK_EMBEDDING_DIMENSION);
+    for (const vector<double>& library_track : library_tracks) {
+        insert_hnsw_vector(library_index, embed_samples(library_track).data());
+    }
+    int self_matches = 0;
+    for (int track_index = 0; track_index < library_track_count; track_index += 3) {
+        audio_processing_buffer altered_track = {library_tracks[track_index], 0.0, 0.0, 0, 1, 0.0};
+        for (double& altered_sample : altered_track.sample_data_array) {
+            altered_sample *= 0.9;
+        }
+        vector<uint8_t> encoded_track;
+        dither_generator_state track_dither = initialize_dither_generator(1, true, false, uint64_t(track_index));
+        export_buffer_to_samples(altered_track, SAMPLE_FORMAT_INT16, true, encoded_track, &track_dither);
+        import_samples_to_buffer(encoded_track.data(), SAMPLE_FORMAT_INT16, frames_per_channel(altered_track), 1, true, altered_track);
+        vector<pair<float, int>> similar_tracks = search_hnsw_index(library_index, embed_samples(altered_track.sample_data_array).data(), 3, 16);
+        self_matches += (!similar_tracks.empty() && similar_tracks[0].second == track_index) ? 1 : 0;
+    }
+    cout << "Library Embeddings: " << library_track_count << " x " << TRACK_EMBEDDING_DIMENSION
+         << " | Altered Copies Matched to Source: " << self_matches << " / " << (library_track_count + 2) / 3 << "\n";
+    
+    // The system measures recall and latency on a larger clustered collection against an exhaustive batched scan
+    const int collection_size = 10000;
+    const int collection_queries = 200;
+    mt19937 embedding_generator(45);
+    normal_distribution<float> component_noise(0.0f, 1.0f);
+    vector<float> cluster_centres(size_t(200) * TRACK_EMBEDDING_DIMENSION);
+    for (float& centre_component : cluster_centres) {
+        centre_component = 3.0f * component_noise(embedding_generator);
+    }
+    auto draw_collection_vector = [&](vector<float>& drawn_vector) {
+        int cluster_index = int(embedding_generator() % 200);
+        for (int dimension_index = 0; dimension_index < TRACK_EMBEDDING_DIMENSION; dimension_index++) {
+            drawn_vector[dimension_index] = cluster_centres[size_t(cluster_index) * TRACK_EMBEDDING_DIMENSION + dimension_index] +
+                                            component_noise(embedding_generator);
+        }
+    };
+    hnsw_index collection_index = initialize_hnsw_index(TRACK_EMBEDDING_DIMENSION);
+    vector<float> drawn_vector(TRACK_EMBEDDING_DIMENSION);
+    auto build_start = chrono::high_resolution_clock::now();
+    for (int vector_index = 0; vector_index < collection_size; vector_index++) {
+        draw_collection_vector(drawn_vector);
+        insert_hnsw_vector(collection_index, drawn_vector.data());
+    }
+    double build_seconds = chrono::duration<double>(chrono::high_resolution_clock::now() - build_start).count();
+    vector<int> every_identifier(collection_size);
+    iota(every_identifier.begin(), every_identifier.end(), 0);
+    vector<float> exhaustive_distances(collection_size);
+    double graph_query_ms = 0.0;
+    double exhaustive_query_ms = 0.0;
+    int recalled_neighbours = 0;
+    for (int query_index = 0; query_index < collection_queries; query_index++) {
+        draw_collection_vector(drawn_vector);
+        auto graph_start = chrono::high_resolution_clock::now();
+        vector<pair<float, int>> graph_neighbours = search_hnsw_index(collection_index, drawn_vector.data(), 10, 64);
+        graph_query_ms += chrono::duration<double, milli>(chrono::high_resolution_clock::now() - graph_start).count();
+        auto exhaustive_start = chrono::high_resolution_clock::now();
+        compute_batch_distances(drawn_vector.data(), collection_index.stored_vectors.data(), every_identifier.data(), collection_size,
+                                TRACK_EMBEDDING_DIMENSION, exhaustive_distances.data());
+        vector<int> exact_neighbours(every_identifier);
+        partial_sort(exact_neighbours.begin(), exact_neighbours.begin() + 10, exact_neighbours.end(),
+                     [&](int left, int right) { return exhaustive_distances[left] < exhaustive_distances[right]; });
+        exhaustive_query_ms += chrono::duration<double, milli>(chrono::high_resolution_clock::now() - exhaustive_start).count();
+        for (const pair<float, int>& graph_neighbour : graph_neighbours) {
+            recalled_neighbours += count(exact_neighbours.begin(), exact_neighbours.begin() + 10, graph_neighbour.second) > 0 ? 1 : 0;
+        }
+    }
+    cout << "Collection: " << collection_size << " vectors | Incremental Build: " << setprecision(2) << build_seconds
+         << " s | Recall@10: " << setprecision(1) << 10.0 * recalled_neighbours / collection_queries << "%\n";
+    cout << "Average k-NN Query: " << setprecision(3) << graph_query_ms / collection_queries << " ms (graph) vs "
+         << exhaustive_query_ms / collection_queries << " ms (exhaustive batched scan)\n";
+    
+    // The system builds a waveform pyramid inside the level pass over two minutes of stereo audio, timing the plain
+    // level pass over the same blocks for comparison
+    cout << "\nWAVEFORM OVERVIEW PYRAMID:\n";
+    cout << string(50, '-') << "\n";
+    const int overview_blocks = int(120.0 * SAMPLE_RATE) / AUDIO_BUFFER_SIZE;
+    test_signal_generator_state overview_source = initialize_test_signal_generator({SIGNAL_PINK_NOISE, 0.6, 0.0, 0.0, 0.0, 0, 0, 0.0, 0.0, 46}, 2);
+    audio_processing_buffer overview_block = {vector<double>(2 * AUDIO_BUFFER_SIZE, 0.0), 0.0, 0.0, 0, 2, 0.0};
+    waveform_pyramid_builder pyramid_builder = initialize_waveform_pyramid(2);
+    double measure_ms = 0.0;
+    double fused_ms = 0.0;
+    double overview_peak = 0.0;
+    double level_mismatch = 0.0;
+    for (int block_index = 0; block_index < overview_blocks; block_index++) {
+        generate_test_signal_block(overview_source, overview_block);
+        double section_gain = 0.2 + 0.8 * fabs(sin(2.0 * M_PI * block_index / 400.0));
+        for (double& overview_sample : overview_block.sample_data_array) {
+            overview_sample *= section_gain;
+        }
+        auto measure_start = chrono::high_resolution_clock::now();
+        measure_audio_buffer_levels(overview_block);
+        auto fused_start = chrono::high_resolution_clock::now();
+        measure_ms += chrono::duration<double, milli>(fused_start - measure_start).count();
+        double plain_peak = overview_block.peak_amplitude_level;
+        double plain_rms = overview_block.rms_power_level;
+        fused_start = chrono::high_resolution_clock::now();
+        measure_audio_buffer_levels(overview_block, pyramid_builder);
+        fused_ms += chrono::duration<double, milli>(chrono::high_resolution_clock::now() - fused_start).count();
+        level_mismatch = max({level_mismatch, fabs(plain_peak - overview_block.peak_amplitude_level),
+                              fabs(plain_rms - overview_block.rms_power_level)});
+        overview_peak = max(overview_peak, overview_block.peak_amplitude_level);
+    }
+    waveform_pyramid overview_pyramid = finalize_waveform_pyramid(pyramid_builder);
+    string overview_sidecar_path = analysis_storage_path("artlest_waveform_overview.awpy");
+    waveform_pyramid loaded_pyramid;
+    bool sidecar_round_trip = write_waveform_sidecar(overview_pyramid, overview_sidecar_path) &&
+                              read_waveform_sidecar(overview_sidecar_path, loaded_pyramid);
+    double sidecar_kilobytes = sidecar_round_trip ? filesystem::file_size(overview_sidecar_path) / 1024.0 : 0.0;
+    cout << "Levels: " << loaded_pyramid.level_buckets.size() << " | Sidecar: " << setprecision(1) << sidecar_kilobytes
+         << " KB for " << setprecision(1) << overview_pyramid.total_frames * 2 * sizeof(float) / 1048576.0 << " MB of float audio"
+         << " | Round Trip: " << (sidecar_round_trip ? "ok" : "FAILED") << "\n";
+    cout << "Level Pass Alone: " << setprecision(2) << measure_ms << " ms | Level Pass + Pyramid (fused): " << fused_ms
+         << " ms | Level Difference: " << scientific << setprecision(1) << level_mismatch << fixed << "\n";
+    
+    const long long zoom_spans[3] = {overview_pyramid.total_frames, (long long)(10.0 * SAMPLE_RATE), (long long)(0.5 * SAMPLE_RATE)};
+    for (long long zoom_span : zoom_spans) {
+        double render_us = 0.0;
+        double rendered_peak = 0.0;
+        for (int channel_index = 0; channel_index < loaded_pyramid.channel_count; channel_index++) {
+            auto render_start = chrono::high_resolution_clock::now();
+            vector<waveform_column> overview_columns = render_waveform_overview(loaded_pyramid, channel_index, 0, zoom_span, 1000);
+            render_us += chrono::duration<double, micro>(chrono::high_resolution_clock::now() - render_start).count();
+            for (const waveform_column& overview_column : overview_columns) {
+                rendered_peak = max({rendered_peak, fabs(overview_column.minimum_level), fabs(overview_column.maximum_level)});
+            }
+        }
+        cout << "Zoom " << setw(6) << setprecision(1) << zoom_span / SAMPLE_RATE << " s @ 2 x 1000 px | Render: " << setprecision(1)
+             << render_us << " us | Column Peak: " << setprecision(4) << rendered_peak;
+        if (zoom_span == overview_pyramid.total_frames) {
+            cout << " (file peak " << overview_peak << ")";
+        }
+        cout << "\n";
+    }
+    
+    // The system corrupts the sidecar's first level size and then truncates it; both must load as rejections
+    waveform_pyramid corrupt_pyramid;
+    uint64_t corrupt_bucket_total = uint64_t(1) << 60;
+    fstream corrupt_stream(overview_sidecar_path, ios::binary | ios::in | ios::out);
+    corrupt_stream.seekp(5 * sizeof(uint32_t) + sizeof(int64_t));
+    corrupt_stream.write(reinterpret_cast<const char*>(&corrupt_bucket_total), sizeof(corrupt_bucket_total));
+    corrupt_stream.close();
+    bool oversized_rejected = !read_waveform_sidecar(overview_sidecar_path, corrupt_pyramid);
+    write_waveform_sidecar(overview_pyramid, overview_sidecar_path);
+    filesystem::resize_file(overview_sidecar_path, filesystem::file_size(overview_sidecar_path) / 2);
+    bool truncated_rejected = !read_waveform_sidecar(overview_sidecar_path, corrupt_pyramid);
+    vector<waveform_column> missing_columns = render_waveform_overview(loaded_pyramid, 2, 0, loaded_pyramid.total_frames, 1000);
+    bool missing_channel_silent = all_of(missing_columns.begin(), missing_columns.end(), [](const waveform_column& missing_column) {
+        return missing_column.minimum_level == 0.0 && missing_column.maximum_level == 0.0 && missing_column.rms_level == 0.0;
+    });
+    cout << "Corrupt Sidecar | Oversized Level: " << (oversized_rejected ? "rejected" : "ACCEPTED") << " | Truncated: "
+         << (truncated_rejected ? "rejected" : "ACCEPTED") << " | Channel 2 of 2: " << (missing_channel_silent ? "empty columns" : "DATA")
+         << "\n";
+    filesystem::remove(overview_sidecar_path);
+    
+    // The system checks an odd bucket count with a partial tail, where coarse levels must still span every bucket
+    const int tail_frames = 6 * WAVEFORM_BASE_BUCKET_FRAMES + WAVEFORM_BASE_BUCKET_FRAMES / 2;
+    audio_processing_buffer tail_block = {vector<double>(tail_frames, 0.5), 0.0, 0.0, 0, 1, 0.0};
+    fill(tail_block.sample_data_array.begin() + 6 * WAVEFORM_BASE_BUCKET_FRAMES, tail_block.sample_data_array.end(), 0.1);
+    tail_block.sample_data_array[4 * WAVEFORM_BASE_BUCKET_FRAMES + 17] = 0.9;
+    waveform_pyramid_builder tail_builder = initialize_waveform_pyramid(1);
+    feed_waveform_pyramid(tail_builder, tail_block);
+    waveform_pyramid tail_pyramid = finalize_waveform_pyramid(tail_builder);
+    waveform_column tail_column = render_waveform_overview(tail_pyramid, 0, 0, tail_pyramid.total_frames, 1)[0];
+    measure_audio_buffer_levels(tail_block);
+    cout << "Odd Tail (6.5 buckets) | Whole-File Column Max: " << setprecision(4) << tail_column.maximum_level
+         << " (true 0.9000) | RMS: " << tail_column.rms_level << " (true " << tail_block.rms_power_level << ")\n";
+    
+    // The system analyses the library twice through the content-hash cache and measures raw hash throughput
+    cout << "\nANALYSIS RESULT CACHE:\n";
+    cout << string(50, '-') << "\n";
+    string analysis_cache_directory = analysis_storage_path("artlest_analysis_cache");
+    filesystem::remove_all(analysis_cache_directory);
+    vector<audio_processing_buffer> cached_library;
+    for (const vector<double>& library_track : library_tracks) {
+        cached_library.push_back({library_track, 0.0, 0.0, 0, 1, 0.0});
+    }
+    for (int cache_pass = 0; cache_pass < 2; cache_pass++) {
+        int cache_hits = 0;
+        double embedding_checksum = 0.0;
+        auto cache_pass_start = chrono::high_resolution_clock::now();
+        for (audio_processing_buffer& library_buffer : cached_library) {
+            bool cache_hit = false;
+            analysis_cache_record cache_record = analyse_buffer_with_cache(analysis_cache_directory, library_buffer, cache_hit);
+            cache_hits += cache_hit ? 1 : 0;
+            embedding_checksum += accumulate(cache_record.extended_features.begin(), cache_record.extended_features.end(), 0.0) +
+                                  library_buffer.peak_amplitude_level + library_buffer.rms_power_level;
+        }
+        double cache_pass_ms = chrono::duration<double, milli>(chrono::high_resolution_clock::now() - cache_pass_start).count();
+        cout << (cache_pass == 0 ? "Cold Pass" : "Warm Pass") << " | Tracks: " << cached_library.size() << " | Cache Hits: " << cache_hits
+             << " | Time: " << setprecision(2) << cache_pass_ms << " ms | Result Checksum: " << setprecision(6) << embedding_checksum << "\n";
+    }
+    cached_library[0].sample_data_array[12345] += 1e-9;
+    bool modified_hit = false;
+    analyse_buffer_with_cache(analysis_cache_directory, cached_library[0], modified_hit);
+    cout << "Single-Sample Edit Detected: " << (modified_hit ? "NO (stale hit)" : "yes (re-analysed)") << "\n";
+    
+    // The system overwrites the stored feature count with an impossible value; the lookup must miss and re-analyse
+    int32_t corrupt_feature_count = 0x7fffffff;
+    fstream corrupt_record(analysis_cache_entry_path(analysis_cache_directory, hash_audio_buffer(cached_library[0])),
+                           ios::binary | ios::in | ios::out);
+    corrupt_record.seekp(2 * sizeof(uint32_t) + sizeof(uint64_t) + 3 * sizeof(double) + 2 * sizeof(int32_t));
+    corrupt_record.write(reinterpret_cast<const char*>(&corrupt_feature_count), sizeof(corrupt_feature_count));
+    corrupt_record.close();
+    bool corrupt_hit = false;
+    analysis_cache_record recovered_record = analyse_buffer_with_cache(analysis_cache_directory, cached_library[0], corrupt_hit);
+    cout << "Corrupt Feature Count: " << (corrupt_hit ? "HIT" : "miss (re-analysed)") << " | Features: "
+         << recovered_record.extended_features.size() << "\n";
+    filesystem::remove_all(analysis_cache_directory);
+    
+    vector<uint8_t> hash_payload(size_t(64) << 20);
+    for (size_t byte_index = 0; byte_index < hash_payload.size(); byte_index++) {
+        hash_payload[byte_index] = uint8_t(byte_index * 2654435761u >> 13);
+    }
+    auto hash_start = chrono::high_resolution_clock::now();
+    uint64_t payload_hash = compute_content_hash(hash_payload.data(), hash_payload.size());
+    double hash_seconds = chrono::duration<double>(chrono::high_resolution_clock::now() - hash_start).count();
+    cout << "Content Hash: " << hex << payload_hash << dec << " | Throughput: " << setprecision(2)
+         << hash_payload.size() / max(hash_seconds, 1e-9) / 1e9 << " GB/s over 64 MB\n";
+    
+    // The system grows and edits a four-minute stereo capture and re-analyses it against a persisted manifest
+    cout << "\nINCREMENTAL RE-ANALYSIS:\n";
+    cout << string(50, '-') << "\n";
+    string capture_path = analysis_storage_path("artlest_live_capture.f32");
+    string capture_manifest_path = analysis_storage_path("artlest_live_capture.ainc");
+    test_signal_generator_state capture_source = initialize_test_signal_generator({SIGNAL_PINK_NOISE, 0.4, 0.0, 0.0, 0.0, 0, 0, 0.0, 0.0, 48}, 2);
+    auto append_capture_audio = [&](double append_seconds) {
+        ofstream capture_stream(capture_path, ios::binary | ios::app);
+        audio_processing_buffer capture_block = {vector<double>(2 * AUDIO_BUFFER_SIZE, 0.0), 0.0, 0.0, 0, 2, 0.0};
+        vector<uint8_t> capture_bytes;
+        for (int block_index = 0; block_index < int(append_seconds * SAMPLE_RATE) / AUDIO_BUFFER_SIZE; block_index++) {
+            generate_test_signal_block(capture_source, capture_block);
+            export_buffer_to_samples(capture_block, SAMPLE_FORMAT_FLOAT32, true, capture_bytes);
+            capture_stream.write(reinterpret_cast<const char*>(capture_bytes.data()), streamsize(capture_bytes.size()));
+        }
+    };
+    auto run_incremental_pass = [&](const char* pass_label, incremental_scan_mode scan_mode) {
+        incremental_analysis_manifest capture_manifest = read_incremental_manifest(capture_manifest_path);
+        auto pass_start = chrono::high_resolution_clock::now();
+        incremental_analysis_report pass_report = reanalyse_pcm_file_incrementally(capture_path, 2, capture_manifest, scan_mode);
+        double pass_ms = chrono::duration<double, milli>(chrono::high_resolution_clock::now() - pass_start).count();
+        write_incremental_manifest(capture_manifest, capture_manifest_path);
+        cout << pass_label << "| Analysed: " << setw(3) << pass_report.analysed_chunks << " | Reused: " << setw(3) << pass_report.reused_chunks
+             << " | Peak: " << setprecision(4) << pass_report.peak_amplitude_level << " | RMS: " << pass_report.rms_power_level
+             << " | Time: " << setprecision(1) << pass_ms << " ms\n";
+        return pass_report;
+    };
+    filesystem::remove(capture_path);
+    filesystem::remove(capture_manifest_path);
+    append_capture_audio(240.0);
+    run_incremental_pass("Initial 4:00 capture     ", SCAN_APPENDED_ONLY);
+    append_capture_audio(10.0);
+    run_incremental_pass("After +10 s appended     ", SCAN_APPENDED_ONLY);
+    {
+        fstream edit_stream(capture_path, ios::binary | ios::in | ios::out);
+        vector<float> edited_frames(size_t(2 * SAMPLE_RATE), 0.9f);
+        edit_stream.seekp(streamoff(size_t(90.0 * SAMPLE_RATE) * 2 * sizeof(float)));
+        edit_stream.write(reinterpret_cast<const char*>(edited_frames.data()), streamsize(edited_frames.size() * sizeof(float)));
+    }
+    incremental_analysis_report edited_report = run_incremental_pass("After 1 s edit at 1:30   ", SCAN_VERIFY_ALL);
+    filesystem::remove(capture_manifest_path);
+    incremental_analysis_report scratch_report = run_incremental_pass("From scratch (reference) ", SCAN_VERIFY_ALL);
+    double embedding_difference = 0.0;
+    for (int dimension_index = 0; dimension_index < TRACK_EMBEDDING_DIMENSION; dimension_index++) {
+        embedding_difference = max(embedding_difference, double(fabs(edited_report.track_embedding[dimension_index] -
+                                                                     scratch_report.track_embedding[dimension_index])));
+    }
+    cout << "Merged vs From-Scratch | RMS Difference: " << scientific << setprecision(2)
+         << fabs(edited_report.rms_power_level - scratch_report.rms_power_level) << " | Embedding Difference: " << embedding_difference
+         << fixed << "\n";
+    
+    // The system inflates the stored chunk count; the manifest must load empty instead of allocating for it
+    size_t stored_chunk_total = read_incremental_manifest(capture_manifest_path).chunk_statistics.size();
+    uint64_t inflated_chunk_total = uint64_t(1) << 40;
+    {
+        fstream manifest_edit_stream(capture_manifest_path, ios::binary | ios::in | ios::out);
+        manifest_edit_stream.seekp(5 * sizeof(uint32_t));
+        manifest_edit_stream.write(reinterpret_cast<const char*>(&inflated_chunk_total), sizeof(inflated_chunk_total));
+    }
+    cout << "Corrupt Manifest | Stored Chunks: " << stored_chunk_total << " | Chunks Loaded After Inflating Count: "
+         << read_incremental_manifest(capture_manifest_path).chunk_statistics.size() << "\n";
+    filesystem::remove(capture_path);
+    filesystem::remove(capture_manifest_path);
+    
+    // The system writes per-frame features of the fingerprint library to a columnar store and scans single columns
+    cout << "\nCOLUMNAR FEATURE STORE:\n";
+    cout << string(50, '-') << "\n";
+    string feature_store_path = analysis_storage_path("artlest_library_features.afcs");
+    vector<feature_column_schema> feature_columns = {{"loudness_db", 0.01}, {"zero_crossing_rate", 0.0001},
+                                                     {"pitch_hz", 0.0}, {"pitch_confidence", 0.001}};
+    feature_store_writer store_writer;
+    open_feature_store_writer(store_writer, feature_store_path, feature_columns);
+    vector<vector<double>> expected_columns(feature_columns.size());
+    size_t stored_frame_total = 0;
+    for (int track_index = 0; track_index < library_track_count; track_index++) {
+        const vector<double>& track_samples = library_tracks[track_index];
+        pitch_tracker_state feature_pitch_tracker = initialize_pitch_tracker({60.0, 1000.0, 512, 0.15, true});
+        vector<pitch_frame_estimate> track_contour;
+        audio_processing_buffer stream_block = {vector<double>(), 0.0, 0.0, 0, 1, 0.0};
+        for (size_t block_start = 0; block_start < track_samples.size(); block_start += AUDIO_BUFFER_SIZE) {
+            size_t block_end = min(track_samples.size(), block_start + AUDIO_BUFFER_SIZE);
+            stream_block.sample_data_array.assign(track_samples.begin() + block_start, track_samples.begin() + block_end);
+            feed_pitch_tracker(feature_pitch_tracker, stream_block, track_contour);
+        }
+        begin_feature_store_track(store_writer, uint32_t(track_index));
+        for (size_t frame_index = 0; frame_index < track_contour.size(); frame_index++) {
+            size_t frame_start = frame_index * 512;
+            size_t frame_end = min(track_samples.size(), frame_start + 512);
+            double frame_energy = 0.0;
+            int sign_changes = 0;
+            for (size_t sample_index = frame_start; sample_index < frame_end; sample_index++) {
+                frame_energy += track_samples[sample_index] * track_samples[sample_index];
+                sign_changes += sample_index > frame_start && (track_samples[sample_index] < 0.0) != (track_samples[sample_index - 1] < 0.0);
+            }
+            double frame_values[4] = {10.0 * log10(frame_energy / max(size_t(1), frame_end - frame_start) + 1e-10),
+                                      double(sign_changes) / max(size_t(1), frame_end - frame_start),
+                                      track_contour[frame_index].frequency_hz, track_contour[frame_index].voicing_confidence};
+            append_feature_frame(store_writer, frame_values);
+            for (size_t column_index = 0; column_index < feature_columns.size(); column_index++) {
+                expected_columns[column_index].push_back(frame_values[column_index]);
+            }
+            stored_frame_total++;
+        }
+    }
+    close_feature_store_writer(store_writer);
+
+    feature_store_reader store_reader;
+    open_feature_store(store_reader, feature_store_path);
+    uintmax_t store_bytes = filesystem::file_size(feature_store_path);
+    cout << "Frames: " << stored_frame_total << " x " << feature_columns.size() << " columns | Access: "
+         << (store_reader.mapped_bytes ? "memory mapped" : "stream reads") << " | Chunks: " << store_reader.chunk_index.size()
+         << " | Size: " << store_bytes << " bytes vs " << stored_frame_total * feature_columns.size() * sizeof(double)
+         << " as double (" << setprecision(1) << double(stored_frame_total * feature_columns.size() * sizeof(double)) / store_bytes << "x)\n";
+    for (size_t column_index = 0; column_index < feature_columns.size(); column_index++) {
+        uint64_t column_bytes = 0;
+        size_t value_position = 0;
+        double largest_error = 0.0;
+        auto scan_start = chrono::high_resolution_clock::now();
+        int decoded_chunks = scan_feature_column(store_reader, feature_columns[column_index].column_name,
+                                                 [&](const feature_chunk_descriptor& chunk_descriptor, const float* chunk_values) {
+            column_bytes += chunk_descriptor.byte_length;
+            for (uint32_t value_index = 0; value_index < chunk_descriptor.value_count; value_index++) {
+                largest_error = max(largest_error, fabs(double(chunk_values[value_index]) - expected_columns[column_index][value_position++]));
+            }
+        });
+        double scan_ms = chrono::duration<double, milli>(chrono::high_resolution_clock::now() - scan_start).count();
+        cout << "Column: " << setw(18) << feature_columns[column_index].column_name << " | Chunks: " << decoded_chunks << " | Bytes: "
+             << setw(6) << column_bytes << " (" << setprecision(2) << double(column_bytes) / max(size_t(1), value_position) << " B/value)"
+             << " | Max Error: " << scientific << largest_error << fixed << " | Scan: " << setprecision(3) << scan_ms << " ms\n";
+    }
+    int loud_frames = 0;
+    int loud_chunks = scan_feature_column(store_reader, "loudness_db", [&](const feature_chunk_descriptor& chunk_descriptor, const float* chunk_values) {
+        loud_frames += int(count_if(chunk_values, chunk_values + chunk_descriptor.value_count, [](float loudness) { return loudness > -10.0f; }));
+    }, -10.0);
+    cout << "Range Scan loudness_db > -10 dB | Chunks Decoded: " << loud_chunks << " of " << library_track_count
+         << " | Matching Frames: " << loud_frames << "\n";
+    close_feature_store(store_reader);
+    filesystem::remove(feature_store_path);
+    
+    // The system renders a ten-minute verse/chorus/bridge arrangement and segments it from a banded chroma matrix
+    cout << "\nSTRUCTURAL SEGMENTATION:\n";
+    cout << string(50, '-') << "\n";
+    const double chord_seconds = 2.0;
+    const int chords_per_section = 16;
+    const double arrangement_seconds = 600.0;
+    vector<vector<vector<int>>> section_progressions = {
+        {{57, 60, 64}, {62, 65, 69}, {57, 60, 64}, {64, 68, 71}},   // Verse: Am Dm Am E
+        {{60, 64, 67}, {55, 59, 62}, {53, 57, 60}, {60, 64, 67}},   // Chorus: C G F C
+        {{58, 62, 65}, {63, 67, 70}, {56, 60, 63}, {58, 62, 65}}};  // Bridge: Bb Eb Ab Bb
+    const string arrangement_pattern = "ABABCB";
+    vector<vector<vector<double>>> rendered_chords(section_progressions.size());
+    for (size_t section_index = 0; section_index < section_progressions.size(); section_index++) {
+        for (const vector<int>& chord_notes : section_progressions[section_index]) {
+            vector<double> chord_samples(size_t(chord_seconds * SAMPLE_RATE), 0.0);
+            vector<int> voiced_notes(chord_notes);
+            voiced_notes.push_back(chord_notes[0] - 12);
+            for (int midi_note : voiced_notes) {
+                double note_frequency = 440.0 * pow(2.0, (midi_note - 69) / 12.0);
+                for (size_t sample_index = 0; sample_index < chord_samples.size(); sample_index++) {
+                    double note_age = sample_index / SAMPLE_RATE;
+                    double note_envelope = 0.08 * min(1.0, note_age / 0.01) * exp(-note_age * 1.2);
+                    for (int harmonic_index = 1; harmonic_index <= 3; harmonic_index++) {
+                        chord_samples[sample_index] += note_envelope / harmonic_index * sin(2.0 * M_PI * harmonic_index * note_frequency * note_age);
+                    }
+                }
+            }
+            rendered_chords[section_index].push_back(chord_samples);
+        }
+    }
+    chroma_extractor_state chroma_extractor = initialize_chroma_extractor(2);
+    mt19937 arrangement_generator(50);
+    string expected_labels;
+    vector<double> expected_boundaries;
+    audio_processing_buffer chord_block = {vector<double>(), 0.0, 0.0, 0, 1, 0.0};
+    auto chroma_start = chrono::high_resolution_clock::now();
+    for (int chord_index = 0; chord_index * chord_seconds < arrangement_seconds; chord_index++) {
+        int section_number = chord_index / chords_per_section;
+        int section_index = arrangement_pattern[section_number % arrangement_pattern.size()] - 'A';
+        if (chord_index % chords_per_section == 0) {
+            expected_labels += char('A' + section_index);
+            if (section_number > 0) {
+                expected_boundaries.push_back(chord_index * chord_seconds);
+            }
+        }
+        const vector<double>& chord_samples = rendered_chords[section_index][chord_index % 4];
+        double chord_gain = uniform_real_distribution<double>(0.7, 1.0)(arrangement_generator);
+        chord_block.sample_data_array.resize(chord_samples.size());
+        transform(chord_samples.begin(), chord_samples.end(), chord_block.sample_data_array.begin(),
+                  [&](double chord_sample) { return chord_gain * chord_sample; });
+        feed_chroma_extractor(chroma_extractor, chord_block);
+    }
+    finalize_chroma_extractor(chroma_extractor);
+    double chroma_ms = chrono::duration<double, milli>(chrono::high_resolution_clock::now() - chroma_start).count();
+    double row_seconds = chroma_extractor.aggregation_frames * chroma_extractor.hop_length / SAMPLE_RATE;
+    int hardware_workers = max(1, int(thread::hardware_concurrency()));
+    structural_segmentation_configuration segmentation_configuration = {48, 64, hardware_workers, 0.1, 16.0, 0.9};
+    int chroma_row_count = int(chroma_extractor.chroma_rows.size()) / CHROMA_BIN_COUNT;
+    vector<float> reference_band_values;
+    for (int worker_count : {1, max(2, hardware_workers)}) {
+        auto band_start = chrono::high_resolution_clock::now();
+        self_similarity_band timing_band = compute_self_similarity_band(chroma_extractor.chroma_rows, CHROMA_BIN_COUNT,
+                                                                        2 * segmentation_configuration.kernel_half_width, 64, worker_count);
+        double band_ms = chrono::duration<double, milli>(chrono::high_resolution_clock::now() - band_start).count();
+        if (reference_band_values.empty()) {
+            reference_band_values = timing_band.similarity_values;
+        }
+        cout << "Banded Similarity | Workers: " << setw(2) << worker_count << " | Rows: " << timing_band.row_count
+             << " | Time: " << setprecision(2) << band_ms << " ms | Matches Single Worker: "
+             << (timing_band.similarity_values == reference_band_values ? "yes" : "no") << "\n";
+    }
+    auto segmentation_start = chrono::high_resolution_clock::now();
+    structural_segmentation_report segmentation_report =
+        segment_track_structure(chroma_extractor.chroma_rows, row_seconds, segmentation_configuration);
+    double segmentation_ms = chrono::duration<double, milli>(chrono::high_resolution_clock::now() - segmentation_start).count();
+    int matched_boundaries = 0;
+    string detected_labels;
+    for (const structural_segment& detected_segment : segmentation_report.segments) {
+        detected_labels += detected_segment.section_label;
+        for (double expected_boundary : expected_boundaries) {
+            matched_boundaries += detected_segment.start_seconds > 0.0 && fabs(detected_segment.start_seconds - expected_boundary) < 1.0;
+        }
+    }
+    cout << "Chroma: " << chroma_row_count << " rows of " << setprecision(3) << row_seconds << " s in " << setprecision(1) << chroma_ms
+         << " ms | Band: " << segmentation_report.band_bytes / 1024 << " KB vs Full Matrix: "
+         << size_t(chroma_row_count) * chroma_row_count * sizeof(float) / 1024 << " KB\n";
+    cout << "Segmentation: " << segmentation_ms << " ms | Boundaries: " << matched_boundaries << "/" << expected_boundaries.size()
+         << " within 1 s | Detected: " << segmentation_report.segments.size() - 1 << "\n";
+    cout << "Expected Labels: " << expected_labels << "\nDetected Labels: " << detected_labels << "\n";
+    structural_segmentation_configuration degenerate_configuration = segmentation_configuration;
+    degenerate_configuration.tile_size = 0;
+    structural_segmentation_report empty_report = segment_track_structure(vector<float>(), row_seconds, degenerate_configuration);
+    structural_segmentation_report untiled_report =
+        segment_track_structure(chroma_extractor.chroma_rows, row_seconds, degenerate_configuration);
+    cout << "Empty Input Segments: " << empty_report.segments.size() << " | Tile Size 0 Segments: " << untiled_report.segments.size()
+         << " (matches " << segmentation_report.segments.size() << ")\n";
+    
+    // The system displays successful program completion status
+    cout << "\nSYSTEM STATUS: Media processing simulation completed successfully\n";
+    cout << "All performance metrics have been analyzed and documented\n";
+    cout << "Program execution terminated with successful status code\n";
+    
+    return 0;                                  // Program returns successful execution status
 }
\ No newline at end of file